@@ -16,8 +16,12 @@
 #include "Nodes/ASTBooleanNode.hpp"
 #include "Nodes/ASTIfStatementNode.hpp"
 #include "Nodes/ASTWhileStatementNode.hpp"
+#include "Nodes/ASTForStatementNode.hpp"
 #include "Nodes/ASTArrayNode.hpp"
 #include "Nodes/ASTArrayElementIdentifier.hpp"
+#include "Nodes/ASTMapNode.hpp"
+#include "Nodes/ASTStructDeclarationNode.hpp"
+#include "Nodes/ASTMemberIdentifier.hpp"
 
 #include "../Tokenizer/TokenizerTypes.hpp"
 
@@ -30,6 +34,12 @@ void ASTBuilder::Build(
 	size_t              index
 )
 {
+	// The root passed in by the user is never given
+	// a type anywhere else, and passes walking the
+	// AST look at it the same as any other node
+	if (index == 0)
+		root->Type(NodeType::ROOT);
+
 	// Build a new node from the tokens at
 	// the current index
 	ptrdiff_t next = index + 1;
@@ -216,6 +226,99 @@ bool ASTBuilder::_BuildIndividualNode(
 			{
 				delete arrayElement;
 
+				return false;
+			}
+		}
+		// An identifier followed by a block is the
+		// definition of a struct
+		else if (tokens[index + 1].type == TokenType::BEGIN_BLOCK)
+		{
+			_ParseStructDefinition(
+				root,
+				tokens,
+				index,
+				next
+			);
+
+			return true;
+		}
+		// Check if this could be a call to a member function
+		// or an assignment to a field of a struct
+		else if (tokens[index + 1].type == TokenType::DOT)
+		{
+			MemberIdentifierNode* member = _ParseMemberIdentifierNode(
+				tokens,
+				index,
+				next
+			);
+
+			if (static_cast<size_t>((*next)) >= tokens.size())
+			{
+				delete member;
+
+				return false;
+			}
+
+			if (tokens[*next].type == TokenType::BEGIN_ARGS)
+			{
+				FunctionCall* call = new FunctionCall();
+				call->Type(NodeType::CALL);
+				call->Position(tokens[index].line, tokens[index].column);
+
+				member->Parent(call);
+				call->Identifier(member);
+
+				_ParseCallArguments(
+					call,
+					tokens,
+					*next,
+					next
+				);
+
+				root->Insert(call);
+
+				return true;
+			}
+			else if (tokens[*next].type == TokenType::EQUAL)
+			{
+				_ParseVariableAssignment(
+					root,
+					tokens,
+					*next,
+					next,
+					member
+				);
+
+				return true;
+			}
+			else if (_IsIncrementDecrementToken(tokens[*next].type))
+			{
+				_ParseVariableIncrementDecrement(
+					root,
+					tokens,
+					*next,
+					next,
+					member
+				);
+
+				return true;
+			}
+			else if (_IsArithmeticAssignmentToken(tokens[*next].type))
+			{
+				_ParseVariableArithmeticAssignment(
+					root,
+					tokens,
+					*next,
+					next,
+					member
+				);
+
+				return true;
+			}
+			else
+			{
+				delete member;
+
 				return false;
 			}
 		}
@@ -257,6 +360,33 @@ bool ASTBuilder::_BuildIndividualNode(
 
 		return true;
 	}
+	// Parse a for statement
+	else if (tokens[index].type == TokenType::FOR_STATEMENT)
+	{
+		_ParseForStatement(
+			root,
+			tokens,
+			index,
+			next
+		);
+
+		return true;
+	}
+	// Parse a break or continue statement
+	else if (
+		tokens[index].type == TokenType::BREAK_STATEMENT ||
+		tokens[index].type == TokenType::CONTINUE_STATEMENT
+	)
+	{
+		_ParseLoopControl(
+			root,
+			tokens,
+			index,
+			next
+		);
+
+		return true;
+	}
 
 	return false;
 }
@@ -277,6 +407,7 @@ void ASTBuilder::_ParseVariableAssignment(
 	// added to the AST
 	AssignmentNode* assignment = new AssignmentNode();
 	assignment->Type(NodeType::ASSIGN);
+	assignment->Position(tokens[(*next)].line, tokens[(*next)].column);
 
 	// Create a new identifier from the
 	// first token if we don't already
@@ -285,6 +416,7 @@ void ASTBuilder::_ParseVariableAssignment(
 	{
 		identifier = new IdentifierNode();
 		identifier->Type(NodeType::IDENTIFIER);
+		identifier->Position(tokens[(*next)].line, tokens[(*next)].column);
 
 		static_cast<IdentifierNode*>(identifier)->Value(tokens[(*next)].value);
 	
@@ -307,6 +439,8 @@ void ASTBuilder::_ParseVariableAssignment(
 	value->Parent(assignment);
 	assignment->Assignment(value);
 
+	_MarkSelfUpdate(assignment);
+
 	root->Insert(assignment);
 }
 
@@ -325,6 +459,7 @@ void ASTBuilder::_ParseReturnStatement(
 	// added to the AST
 	ReturnNode* retStatement = new ReturnNode();
 	retStatement->Type(NodeType::RETURN);
+	retStatement->Position(tokens[(*next)].line, tokens[(*next)].column);
 
 	// Move on to the data that is going to
 	// be returned
@@ -339,6 +474,16 @@ void ASTBuilder::_ParseReturnStatement(
 	value->Parent(retStatement);
 	retStatement->Returned(value);
 
+	// Returning always leaves the function, so a call
+	// being returned is the last thing the function does,
+	// and can be ran within the function's own frame
+	if (
+		value->Type() == NodeType::CALL &&
+		static_cast<FunctionCall*>(value)->Flags() == CallFlags::NONE &&
+		static_cast<FunctionCall*>(value)->Identifier()->Type() == NodeType::IDENTIFIER
+	)
+		static_cast<FunctionCall*>(value)->TailCall(true);
+
 	root->Insert(retStatement);
 }
 
@@ -351,6 +496,7 @@ void ASTBuilder::_ParseIfStatement(
 {
 	IfStatement* statement = new IfStatement();
 	statement->Type(NodeType::IF_STATEMENT);
+	statement->Position(tokens[index].line, tokens[index].column);
 
 	_ParseIfStatement(
 		statement,
@@ -557,6 +703,7 @@ void ASTBuilder::_ParseWhileStatement(
 	// the root node
 	WhileStatement* whileStatement = new WhileStatement();
 	whileStatement->Type(NodeType::WHILE_STATEMENT);
+	whileStatement->Position(tokens[(*next)].line, tokens[(*next)].column);
 
 	// Move on to trying to parse the conditions
 	(*next)++;
@@ -583,9 +730,148 @@ void ASTBuilder::_ParseWhileStatement(
 
 	RootNode* body = new RootNode();
 
+	_ParseLoopBody(
+		body,
+		tokens,
+		next
+	);
+
+	whileStatement->Body(body);
+
+	root->Insert(whileStatement);
+}
+
+void ASTBuilder::_ParseForStatement(
+	RootNode*           root,
+	std::vector<Token>& tokens,
+	size_t              index,
+	ptrdiff_t*          next
+)
+{
+	*next = index;
+
+	ForStatement* forStatement = new ForStatement();
+	forStatement->Type(NodeType::FOR_STATEMENT);
+	forStatement->Position(tokens[(*next)].line, tokens[(*next)].column);
+
+	(*next)++;
+
+	if (static_cast<size_t>((*next)) < tokens.size() && tokens[*next].type == TokenType::BEGIN_ARGS)
+		(*next)++;
+
+	// A loop without a variable, or without anything to
+	// go through, is left out of the AST entirely
+	if (
+		static_cast<size_t>((*next) + 2) >= tokens.size()   ||
+		tokens[*next].type       != TokenType::IDENTIFIER ||
+		tokens[(*next) + 1].type != TokenType::IN
+	)
+	{
+		delete forStatement;
+
+		return;
+	}
+
+	IdentifierNode* identifier = new IdentifierNode();
+	identifier->Type(NodeType::IDENTIFIER);
+	identifier->Position(tokens[(*next)].line, tokens[(*next)].column);
+	identifier->Value(tokens[(*next)].value);
+
+	forStatement->Identifier(identifier);
+
+	// Move past the identifier and "in"
+	(*next) += 2;
+
+	Node* start = _GetPassableNode(
+		tokens,
+		*next,
+		next
+	);
+
+	if (!start)
+	{
+		delete forStatement;
+
+		return;
+	}
+
+	// Two periods after the first value make
+	// it the start of a range
+	if (static_cast<size_t>((*next)) < tokens.size() && tokens[*next].type == TokenType::RANGE)
+	{
+		(*next)++;
+
+		Node* end = nullptr;
+
+		if (static_cast<size_t>((*next)) < tokens.size())
+			end = _GetPassableNode(
+				tokens,
+				*next,
+				next
+			);
+
+		if (!end)
+		{
+			delete start;
+			delete forStatement;
+
+			return;
+		}
+
+		forStatement->Range(start, end);
+	}
+	else
+		forStatement->Iterable(start);
+
+	if (static_cast<size_t>((*next)) < tokens.size() && tokens[*next].type == TokenType::END_ARGS)
+		(*next)++;
+
+	RootNode* body = new RootNode();
+
+	_ParseLoopBody(
+		body,
+		tokens,
+		next
+	);
+
+	forStatement->Body(body);
+
+	root->Insert(forStatement);
+}
+
+void ASTBuilder::_ParseLoopControl(
+	RootNode*           root,
+	std::vector<Token>& tokens,
+	size_t              index,
+	ptrdiff_t*          next
+)
+{
+	*next = index;
+
+	// Neither statement holds anything more
+	// than its type and position
+	Node* control = new Node();
+	control->Type(
+		(tokens[(*next)].type == TokenType::BREAK_STATEMENT) ?
+		NodeType::BREAK :
+		NodeType::CONTINUE
+	);
+	control->Position(tokens[(*next)].line, tokens[(*next)].column);
+
+	(*next)++;
+
+	root->Insert(control);
+}
+
+void ASTBuilder::_ParseLoopBody(
+	RootNode*           body,
+	std::vector<Token>& tokens,
+	ptrdiff_t*          next
+)
+{
 	// Once we are done with the condition, check if there's a
 	// BEGIN_BLOCK token at the current location
-	if (tokens[*next].type == TokenType::BEGIN_BLOCK)
+	if (static_cast<size_t>((*next)) < tokens.size() && tokens[*next].type == TokenType::BEGIN_BLOCK)
 	{
 		(*next)++;
 
@@ -611,19 +897,13 @@ void ASTBuilder::_ParseWhileStatement(
 			))
 			(*next)++;
 		}
-
-		// Now add the body statements to the declaration
-		// and add the declaration to the root
-		whileStatement->Body(body);
-
-		root->Insert(whileStatement);
 	}
 	// This might be a little bit funky but, I usually omit braces
 	// in an if statement if it is only one line, so therefore, I'm
 	// going to make it so that, if there is no BEGIN_BLOCK, a statement
 	// will be yanked ahead and put into the body, this could be a cause
 	// for errors in a user's code, but that's more operator error, I feel
-	else
+	else if (static_cast<size_t>((*next)) < tokens.size())
 	{
 		bool madeNew = _BuildIndividualNode(
 			body,
@@ -634,13 +914,6 @@ void ASTBuilder::_ParseWhileStatement(
 
 		if (!madeNew)
 			(*next)++;
-
-		// Set the body to the root node with
-		// only one expression inside and then
-		// continue
-		whileStatement->Body(body);
-
-		root->Insert(whileStatement);
 	}
 }
 
@@ -748,10 +1021,13 @@ void ASTBuilder::_ParseFunctionCall(
 	// as the index passed in
 	*next = index;
 
+	call->Position(tokens[(*next)].line, tokens[(*next)].column);
+
 	// Set the identifier as the first token
 	// at the passed in index
 	IdentifierNode* identifier = new IdentifierNode();
 	identifier->Type(NodeType::IDENTIFIER);
+	identifier->Position(tokens[(*next)].line, tokens[(*next)].column);
 
 	identifier->Value(tokens[(*next)].value);
 
@@ -764,9 +1040,30 @@ void ASTBuilder::_ParseFunctionCall(
 	call->SetFlags(_GetCallFlagFromIdentifier(tokens[(*next)].value));
 
 	// We know that there's a begin args
-	// after this identifier, so just
-	// run next twice to skip it
+	// after this identifier, so move on
+	// to it
 	(*next)++;
+
+	_ParseCallArguments(
+		call,
+		tokens,
+		*next,
+		next
+	);
+}
+
+void ASTBuilder::_ParseCallArguments(
+	FunctionCall*       call,
+	std::vector<Token>& tokens,
+	size_t              index,
+	ptrdiff_t*          next
+)
+{
+	// Start by setting the next token
+	// as the index passed in, and move
+	// past the begin args
+	*next = index;
+
 	(*next)++;
 
 	// Now, we have a while loop to try
@@ -848,6 +1145,8 @@ void ASTBuilder::_ParseVariableIncrementDecrement(
 
 	assignment->Assignment(operation);
 
+	_MarkSelfUpdate(assignment);
+
 	root->Insert(assignment);
 }
 
@@ -945,6 +1244,8 @@ void ASTBuilder::_ParseVariableArithmeticAssignment(
 
 	assignment->Assignment(operation);
 
+	_MarkSelfUpdate(assignment);
+
 	root->Insert(assignment);
 }
 
@@ -1014,11 +1315,13 @@ void ASTBuilder::_ParseFunctionDefinition(
 	// to be added to the root
 	FunctionDeclaration* declaration = new FunctionDeclaration();
 	declaration->Type(NodeType::FUNCTION);
+	declaration->Position(tokens[*next].line, tokens[*next].column);
 
 	// Set the identifier using the
 	// index as the first node
 	IdentifierNode* identifier = new IdentifierNode();
 	identifier->Type(NodeType::IDENTIFIER);
+	identifier->Position(tokens[*next].line, tokens[*next].column);
 
 	identifier->Value(tokens[*next].value);
 
@@ -1061,6 +1364,7 @@ void ASTBuilder::_ParseFunctionDefinition(
 
 		IdentifierNode* argument = new IdentifierNode();
 		argument->Type(NodeType::IDENTIFIER);
+		argument->Position(tokens[*next].line, tokens[*next].column);
 
 		argument->Value(tokens[*next].value);
 
@@ -1104,6 +1408,66 @@ void ASTBuilder::_ParseFunctionDefinition(
 	root->Insert(declaration);
 }
 
+void ASTBuilder::_ParseStructDefinition(
+	RootNode*           root,
+	std::vector<Token>& tokens,
+	size_t              index,
+	ptrdiff_t*          next
+)
+{
+	// Start by setting the next token
+	// as the index passed in
+	*next = index;
+
+	// Create the struct declaration node
+	// to be added to the root
+	StructDeclaration* declaration = new StructDeclaration();
+	declaration->Type(NodeType::STRUCT_DECLARATION);
+	declaration->Position(tokens[*next].line, tokens[*next].column);
+
+	IdentifierNode* identifier = new IdentifierNode();
+	identifier->Type(NodeType::IDENTIFIER);
+	identifier->Position(tokens[*next].line, tokens[*next].column);
+
+	identifier->Value(tokens[*next].value);
+
+	declaration->Identifier(identifier);
+
+	// Move past the identifier and the
+	// beginning of the block
+	(*next)++;
+	(*next)++;
+
+	// Parse the fields and member functions
+	// the same way as the statements within
+	// any other block
+	RootNode* body = new RootNode();
+
+	while (static_cast<size_t>((*next)) < tokens.size())
+	{
+		if (tokens[*next].type == TokenType::END_BLOCK)
+		{
+			(*next)++;
+
+			break;
+		}
+
+		if (!_BuildIndividualNode(
+			body,
+			tokens,
+			*next,
+			next
+		))
+			(*next)++;
+	}
+
+	// Setting the body lays out the slot
+	// of each member
+	declaration->Body(body);
+
+	root->Insert(declaration);
+}
+
 Node* ASTBuilder::_GetPassableNode(
 	std::vector<Token>& tokens,
 	size_t              index,
@@ -1169,6 +1533,75 @@ Node* ASTBuilder::_GetPassableNode(
 
 		return call;
 	}
+	// Parse as an access to a member of a struct, or
+	// a call to a member function
+	else if (
+		static_cast<size_t>((*next) + 1) < tokens.size()  &&
+		tokens[(*next)].type     == TokenType::IDENTIFIER &&
+		tokens[(*next) + 1].type == TokenType::DOT
+	)
+	{
+		Node* member = _ParseMemberIdentifierNode(
+			tokens,
+			*next,
+			next
+		);
+
+		if (
+			static_cast<size_t>((*next)) < tokens.size() &&
+			tokens[*next].type == TokenType::BEGIN_ARGS
+		)
+		{
+			FunctionCall* call = new FunctionCall();
+			call->Type(NodeType::CALL);
+			call->Position(tokens[index].line, tokens[index].column);
+
+			member->Parent(call);
+			call->Identifier(member);
+
+			_ParseCallArguments(
+				call,
+				tokens,
+				*next,
+				next
+			);
+
+			member = call;
+		}
+
+		// Parse this member as being a part
+		// of a binary operation
+		if (
+			static_cast<size_t>((*next)) < tokens.size() &&
+			IsBinaryType(tokens[*next].type)
+		)
+			return _GetPassableBinaryOperation(
+				tokens,
+				*next,
+				next,
+				ignoreLogic,
+				member
+			);
+
+		if (
+			static_cast<size_t>((*next)) < tokens.size() &&
+			(tokens[*next].type == TokenType::AND || tokens[*next].type == TokenType::OR) &&
+			!ignoreLogic
+		)
+		{
+			delete member;
+
+			Node* logical = _ParseLogicalOperation(
+				tokens,
+				index,
+				next
+			);
+
+			return logical;
+		}
+
+		return member;
+	}
 	else if (
 		static_cast<size_t>((*next) + 1) < tokens.size() &&
 		IsBinaryType(tokens[(*next) + 1].type)
@@ -1213,6 +1646,22 @@ Node* ASTBuilder::_GetPassableNode(
 
 		return arrayNode;
 	}
+	// Parse as a map definition
+	else if (tokens[(*next)].type == TokenType::BEGIN_BLOCK)
+	{
+		MapNode* mapNode = new MapNode();
+		mapNode->Type(NodeType::MAP);
+		mapNode->Position(tokens[(*next)].line, tokens[(*next)].column);
+
+		_ParseMapNode(
+			mapNode,
+			tokens,
+			*next,
+			next
+		);
+
+		return mapNode;
+	}
 	// Parse as an array access
 	else if (
 		static_cast<size_t>((*next) + 1) < tokens.size()  &&
@@ -1586,6 +2035,75 @@ void ASTBuilder::_ParseArrayNode(
 	}
 }
 
+void ASTBuilder::_ParseMapNode(
+	MapNode*            mapNode,
+	std::vector<Token>& tokens,
+	size_t              index,
+	ptrdiff_t*          next
+)
+{
+	// Start by setting the next token
+	// as the index passed in
+	*next = index;
+
+	// Move past the beginning of the block
+	// to the first key
+	(*next)++;
+
+	// Parse each pair of a key, a colon, and
+	// a value, separated by commas, until the
+	// end of the block
+	while (static_cast<size_t>((*next)) < tokens.size())
+	{
+		if (tokens[*next].type == TokenType::END_BLOCK)
+		{
+			(*next)++;
+
+			break;
+		}
+
+		if (tokens[*next].type == TokenType::ARG_SEPERATOR)
+		{
+			(*next)++;
+
+			continue;
+		}
+
+		Node* key = _GetPassableNode(
+			tokens,
+			*next,
+			next
+		);
+
+		if (!key)
+		{
+			(*next)++;
+
+			continue;
+		}
+
+		// A key without a colon has no value, which
+		// the checker reports
+		Node* value = nullptr;
+
+		if (
+			static_cast<size_t>((*next)) < tokens.size() &&
+			tokens[*next].type == TokenType::COLON
+		)
+		{
+			(*next)++;
+
+			value = _GetPassableNode(
+				tokens,
+				*next,
+				next
+			);
+		}
+
+		mapNode->InsertPair(key, value);
+	}
+}
+
 void ASTBuilder::_ParseArrayElementIdentifierNode(
 	ArrayElementIdentifierNode* identifier,
 	std::vector<Token>&         tokens,
@@ -1617,6 +2135,83 @@ void ASTBuilder::_ParseArrayElementIdentifierNode(
 	);
 
 	identifier->Index(element);
+
+	// Another index right after the first is
+	// the column of an element of a matrix
+	if (
+		static_cast<size_t>((*next) + 1) < tokens.size()     &&
+		tokens[*next].type       == TokenType::RIGHT_BRACKET &&
+		tokens[(*next) + 1].type == TokenType::LEFT_BRACKET
+	)
+	{
+		(*next)++;
+		(*next)++;
+
+		identifier->Column(
+			_GetPassableNode(
+				tokens,
+				*next,
+				next
+			)
+		);
+	}
+}
+
+MemberIdentifierNode* ASTBuilder::_ParseMemberIdentifierNode(
+	std::vector<Token>& tokens,
+	size_t              index,
+	ptrdiff_t*          next
+)
+{
+	// Start by setting the next token
+	// as the index passed in
+	*next = index;
+
+	// The first object is always the
+	// identifier at the passed in index
+	Node* object = nullptr;
+	_CreateSingleNodeFromToken(
+		&object,
+		tokens[*next]
+	);
+
+	(*next)++;
+
+	MemberIdentifierNode* member = nullptr;
+
+	// Each period and name after it accesses
+	// a member of the object before it
+	while (
+		static_cast<size_t>((*next) + 1) < tokens.size() &&
+		tokens[*next].type       == TokenType::DOT       &&
+		tokens[(*next) + 1].type == TokenType::IDENTIFIER
+	)
+	{
+		member = new MemberIdentifierNode();
+		member->Type(NodeType::MEMBER_IDENTIFIER);
+		member->Position(tokens[(*next) + 1].line, tokens[(*next) + 1].column);
+		member->Object(object);
+		member->Member(tokens[(*next) + 1].value);
+
+		object = member;
+
+		(*next)++;
+		(*next)++;
+	}
+
+	// A period without a name after it still
+	// makes an access, with a missing member
+	if (!member)
+	{
+		member = new MemberIdentifierNode();
+		member->Type(NodeType::MEMBER_IDENTIFIER);
+		member->Position(tokens[index].line, tokens[index].column);
+		member->Object(object);
+
+		(*next)++;
+	}
+
+	return member;
 }
 
 void ASTBuilder::_CreateSingleNodeFromToken(
@@ -1674,6 +2269,11 @@ void ASTBuilder::_CreateSingleNodeFromToken(
 	default:
 		break;
 	}
+
+	// Keep track of where in the source
+	// the node was created from
+	if (*node)
+		(*node)->Position(token.line, token.column);
 }
 
 bool ASTBuilder::_IsIncrementDecrementToken(const TokenType& type)
@@ -1691,6 +2291,27 @@ bool ASTBuilder::_IsArithmeticAssignmentToken(const TokenType& type)
 		   (type == TokenType::MODULUS_EQUAL);
 }
 
+void ASTBuilder::_MarkSelfUpdate(AssignmentNode* assignment)
+{
+	if (
+		assignment->GetIdentifier()->Type() != NodeType::IDENTIFIER ||
+		assignment->GetAssignment()->Type() != NodeType::BINARY_OP
+	)
+		return;
+
+	BinaryOperation* operation = static_cast<BinaryOperation*>(assignment->GetAssignment());
+
+	if (
+		IsLogicalOperation(operation->Operation()) ||
+		operation->GetLeftHand()->Type() != NodeType::IDENTIFIER
+	)
+		return;
+
+	const std::string& identifier = static_cast<IdentifierNode*>(assignment->GetIdentifier())->Value();
+
+	assignment->SelfUpdate(static_cast<IdentifierNode*>(operation->GetLeftHand())->Value() == identifier);
+}
+
 CallFlags ASTBuilder::_GetCallFlagFromIdentifier(const std::string& identifier)
 {
 	if (identifier == "print")
@@ -1711,6 +2332,56 @@ CallFlags ASTBuilder::_GetCallFlagFromIdentifier(const std::string& identifier)
 		return CallFlags::PUSH_COLLECTION;
 	else if (identifier == "pop")
 		return CallFlags::POP_COLLECTION;
+	else if (identifier == "substr")
+		return CallFlags::SUBSTRING;
+	else if (identifier == "slice")
+		return CallFlags::SLICE;
+	else if (identifier == "split")
+		return CallFlags::SPLIT;
+	else if (identifier == "join")
+		return CallFlags::JOIN;
+	else if (identifier == "sum")
+		return CallFlags::SUM;
+	else if (identifier == "min")
+		return CallFlags::MINIMUM;
+	else if (identifier == "max")
+		return CallFlags::MAXIMUM;
+	else if (identifier == "dot")
+		return CallFlags::DOT;
+	else if (identifier == "scale")
+		return CallFlags::SCALE;
+	else if (identifier == "add_each")
+		return CallFlags::ADD_EACH;
+	else if (identifier == "count")
+		return CallFlags::COUNT;
+	else if (identifier == "has")
+		return CallFlags::HAS_KEY;
+	else if (identifier == "keys")
+		return CallFlags::KEYS;
+	else if (identifier == "sort")
+		return CallFlags::SORT;
+	else if (identifier == "sort_desc")
+		return CallFlags::SORT_DESCENDING;
+	else if (identifier == "index_of")
+		return CallFlags::INDEX_OF;
+	else if (identifier == "bsearch")
+		return CallFlags::BINARY_SEARCH;
+	else if (identifier == "lower_bound")
+		return CallFlags::LOWER_BOUND;
+	else if (identifier == "matrix")
+		return CallFlags::MATRIX;
+	else if (identifier == "matmul")
+		return CallFlags::MATRIX_MULTIPLY;
+	else if (identifier == "transpose")
+		return CallFlags::TRANSPOSE;
+	else if (identifier == "row_sums")
+		return CallFlags::ROW_SUMS;
+	else if (identifier == "col_sums")
+		return CallFlags::COLUMN_SUMS;
+	else if (identifier == "rows")
+		return CallFlags::ROWS;
+	else if (identifier == "cols")
+		return CallFlags::COLUMNS;
 
 	return CallFlags::NONE;
 }
\ No newline at end of file
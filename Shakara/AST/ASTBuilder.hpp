@@ -16,10 +16,16 @@ namespace Shakara
 
 		class BinaryOperation;
 
+		class AssignmentNode;
+
 		class ArrayElementIdentifierNode;
 
 		class ArrayNode;
 
+		class MapNode;
+
+		class MemberIdentifierNode;
+
 		class IfStatement;
 
 		enum class CallFlags : uint8_t;
@@ -125,6 +131,42 @@ namespace Shakara
 				ptrdiff_t*          next
 			);
 
+			/**
+			 * Attempt to parse a for statement to the AST,
+			 * going through either a range of integers or
+			 * the elements of an array.
+			 */
+			void _ParseForStatement(
+				RootNode*           root,
+				std::vector<Token>& tokens,
+				size_t              index,
+				ptrdiff_t*          next
+			);
+
+			/**
+			 * Parse a break or continue statement to the
+			 * AST.
+			 *
+			 * The checker will make sure that neither is
+			 * used outside of a loop.
+			 */
+			void _ParseLoopControl(
+				RootNode*           root,
+				std::vector<Token>& tokens,
+				size_t              index,
+				ptrdiff_t*          next
+			);
+
+			/**
+			 * Parse the body of a loop into the passed in
+			 * root node, either a block or a single statement.
+			 */
+			void _ParseLoopBody(
+				RootNode*           body,
+				std::vector<Token>& tokens,
+				ptrdiff_t*          next
+			);
+
 			/**
 			 * Attempt to parse a logical operation into
 			 * the AST.
@@ -158,6 +200,17 @@ namespace Shakara
 				ptrdiff_t*          next
 			);
 
+			/**
+			 * Parse the arguments of a function call,
+			 * starting from the beginning of them.
+			 */
+			void _ParseCallArguments(
+				FunctionCall*       call,
+				std::vector<Token>& tokens,
+				size_t              index,
+				ptrdiff_t*          next
+			);
+
 			/**
 			 * Parse an increment or decrement
 			 * assignment to a variable.
@@ -215,6 +268,18 @@ namespace Shakara
 				ptrdiff_t*          next
 			);
 
+			/**
+			 * Attempt to parse a struct definition,
+			 * made of field assignments and function
+			 * definitions
+			 */
+			void _ParseStructDefinition(
+				RootNode*           root,
+				std::vector<Token>& tokens,
+				size_t              index,
+				ptrdiff_t*          next
+			);
+
 			/**
 			 * Checks if the token after index matches
 			 * a BEGIN_ARGs, which then means it's a
@@ -277,6 +342,17 @@ namespace Shakara
 				ptrdiff_t*          next
 			);
 
+			/**
+			 * Parses a map definition of keys and
+			 * values into a map node
+			 */
+			void _ParseMapNode(
+				MapNode*            mapNode,
+				std::vector<Token>& tokens,
+				size_t              index,
+				ptrdiff_t*          next
+			);
+
 			/**
 			 * Parses an array access into an ArrayElementIdentifierNode
 			 */
@@ -287,6 +363,16 @@ namespace Shakara
 				ptrdiff_t*                  next
 			);
 
+			/**
+			 * Parses an access to a member of a struct, such
+			 * as "object.member", into a MemberIdentifierNode
+			 */
+			MemberIdentifierNode* _ParseMemberIdentifierNode(
+				std::vector<Token>& tokens,
+				size_t              index,
+				ptrdiff_t*          next
+			);
+
 			void _CreateSingleNodeFromToken(
 				Node**        node,
 				const Token& token
@@ -296,6 +382,13 @@ namespace Shakara
 
 			bool _IsArithmeticAssignmentToken(const TokenType& type);
 
+			/**
+			 * Mark an assignment as updating a variable in
+			 * place, if it assigns an arithmetic operation
+			 * with the variable on its left hand.
+			 */
+			void _MarkSelfUpdate(AssignmentNode* assignment);
+
 			CallFlags _GetCallFlagFromIdentifier(const std::string& identifier);
 
 		};
@@ -0,0 +1,503 @@
+#include "../stdafx.hpp"
+#include "ASTChecker.hpp"
+
+#include "ASTTypes.hpp"
+#include "ASTNode.hpp"
+#include "Nodes/ASTAssignmentNode.hpp"
+#include "Nodes/ASTIdentifierNode.hpp"
+#include "Nodes/ASTRootNode.hpp"
+#include "Nodes/ASTFunctionDeclarationNode.hpp"
+#include "Nodes/ASTFunctionCallNode.hpp"
+#include "Nodes/ASTMapNode.hpp"
+#include "Nodes/ASTStructDeclarationNode.hpp"
+#include "Nodes/ASTMemberIdentifier.hpp"
+#include "Nodes/ASTArrayElementIdentifier.hpp"
+#include "Nodes/ASTForStatementNode.hpp"
+
+using namespace Shakara;
+using namespace Shakara::AST;
+
+/**
+ * Grab the name of the variable that would be
+ * changed by writing to the passed in node, or
+ * nullptr if it isn't a variable at all
+ */
+static const std::string* WrittenVariable(Node* node)
+{
+	// Members are stored within the instance,
+	// which is stored within a variable
+	while (node->Type() == NodeType::MEMBER_IDENTIFIER)
+		node = static_cast<MemberIdentifierNode*>(node)->Object();
+
+	if (node->Type() == NodeType::IDENTIFIER)
+		return &static_cast<IdentifierNode*>(node)->Value();
+	else if (node->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+		return &static_cast<ArrayElementIdentifierNode*>(node)->ArrayIdentifier();
+
+	return nullptr;
+}
+
+bool ASTChecker::Check(RootNode* root)
+{
+	m_errors = 0;
+	m_loops  = 0;
+
+	m_declarations.clear();
+	m_definitions.clear();
+	m_globalDefinitions.clear();
+
+	// Find every definition first, as calls
+	// can be made before the function they
+	// call is declared in the source
+	_CollectDefinitions(root, false);
+
+	_CheckNode(root, false);
+
+	if (m_errors == 0)
+		_MarkPureFunctions();
+
+	// Only call the error handler once, after
+	// every error has been reported
+	if (m_errors > 0 && m_errorHandle)
+		m_errorHandle();
+
+	return m_errors == 0;
+}
+
+void ASTChecker::_CollectDefinitions(Node* node, bool function)
+{
+	if (node->Type() == NodeType::FUNCTION)
+	{
+		FunctionDeclaration* declaration = static_cast<FunctionDeclaration*>(node);
+
+		const std::string& identifier = static_cast<IdentifierNode*>(declaration->Identifier())->Value();
+
+		if (!function)
+		{
+			m_declarations[identifier] = declaration;
+			m_globalDefinitions[identifier]++;
+		}
+
+		m_definitions[identifier]++;
+
+		// Signature arguments are also definitions, as
+		// they would shadow a function of the same name
+		for (size_t index = 0; index < declaration->Arguments().size(); index++)
+		{
+			Node* argument = declaration->Arguments()[index];
+
+			if (argument->Type() == NodeType::IDENTIFIER)
+				m_definitions[static_cast<IdentifierNode*>(argument)->Value()]++;
+		}
+
+		_CollectDefinitions(declaration->Body(), true);
+
+		return;
+	}
+
+	// Member functions are only called through an
+	// instance, so they aren't global declarations
+	if (node->Type() == NodeType::STRUCT_DECLARATION)
+	{
+		StructDeclaration* declaration = static_cast<StructDeclaration*>(node);
+
+		const std::string& identifier = static_cast<IdentifierNode*>(declaration->Identifier())->Value();
+
+		if (!function)
+			m_globalDefinitions[identifier]++;
+
+		m_definitions[identifier]++;
+
+		_CollectDefinitions(declaration->Body(), true);
+
+		return;
+	}
+
+	// The variable of a for loop hides anything else
+	// by its name within the loop, the same as if it
+	// were assigned to
+	if (node->Type() == NodeType::FOR_STATEMENT)
+	{
+		const std::string& name = static_cast<IdentifierNode*>(static_cast<ForStatement*>(node)->Identifier())->Value();
+
+		if (!function)
+			m_globalDefinitions[name]++;
+
+		m_definitions[name]++;
+	}
+
+	// Assigning to an identifier of a function replaces
+	// it within the scope, so count it as a definition
+	if (node->Type() == NodeType::ASSIGN)
+	{
+		Node* identifier = static_cast<AssignmentNode*>(node)->GetIdentifier();
+
+		if (identifier->Type() == NodeType::IDENTIFIER)
+		{
+			const std::string& name = static_cast<IdentifierNode*>(identifier)->Value();
+
+			if (!function)
+				m_globalDefinitions[name]++;
+
+			m_definitions[name]++;
+		}
+	}
+
+	node->VisitChildren([this, function](Node*& child) {
+		_CollectDefinitions(child, function);
+	});
+}
+
+void ASTChecker::_CheckNode(Node* node, bool function)
+{
+	if (node->Type() == NodeType::FUNCTION)
+	{
+		_CheckFunctionDeclaration(
+			static_cast<FunctionDeclaration*>(node),
+			function
+		);
+
+		return;
+	}
+	else if (node->Type() == NodeType::STRUCT_DECLARATION)
+	{
+		_CheckStructDeclaration(
+			static_cast<StructDeclaration*>(node),
+			function
+		);
+
+		return;
+	}
+	else if (node->Type() == NodeType::RETURN)
+	{
+		if (!function)
+			_ReportError(node, "Cannot return outside of a function body!");
+	}
+	else if (node->Type() == NodeType::BREAK || node->Type() == NodeType::CONTINUE)
+	{
+		if (m_loops == 0)
+			_ReportError(node, std::string("Cannot ") + GetNodeTypeName(node->Type()) + " outside of a loop!");
+	}
+	else if (node->Type() == NodeType::CALL)
+		_CheckFunctionCall(static_cast<FunctionCall*>(node));
+	else if (node->Type() == NodeType::FOR_STATEMENT)
+		_CheckForStatement(static_cast<ForStatement*>(node));
+	else if (node->Type() == NodeType::MEMBER_IDENTIFIER)
+	{
+		if (static_cast<MemberIdentifierNode*>(node)->Member().empty())
+			_ReportError(node, "Expected the name of a member after a period!");
+	}
+	else if (node->Type() == NodeType::MAP)
+	{
+		MapNode* map = static_cast<MapNode*>(node);
+
+		for (size_t index = 0; index < map->Pairs(); index++)
+			if (!map->PairValue(index))
+				_ReportError(map->PairKey(index), "Key within a map definition is missing a value!");
+	}
+
+	const bool loop = (
+		node->Type() == NodeType::WHILE_STATEMENT ||
+		node->Type() == NodeType::FOR_STATEMENT
+	);
+
+	if (loop)
+		m_loops++;
+
+	node->VisitChildren([this, function](Node*& child) {
+		_CheckNode(child, function);
+	});
+
+	if (loop)
+		m_loops--;
+}
+
+void ASTChecker::_CheckFunctionDeclaration(
+	FunctionDeclaration* declaration,
+	bool                 function
+)
+{
+	if (function)
+		_ReportError(declaration, "Cannot declare a function within another function!");
+
+	// The signature should always be made of
+	// identifiers, no exceptions
+	for (size_t index = 0; index < declaration->Arguments().size(); index++)
+	{
+		Node* signature = declaration->Arguments()[index];
+
+		if (signature->Type() != NodeType::IDENTIFIER)
+			_ReportError(
+				signature,
+				std::string("Arguments within a function signature cannot be anything but a IDENTIFIER, recieved type of: ") +
+				GetNodeTypeName(signature->Type())
+			);
+	}
+
+	// Everything within the body is now within a
+	// function, and outside of any loop around it
+	const size_t loops = m_loops;
+
+	m_loops = 0;
+
+	_CheckNode(declaration->Body(), true);
+
+	m_loops = loops;
+}
+
+void ASTChecker::_CheckStructDeclaration(
+	StructDeclaration* declaration,
+	bool               function
+)
+{
+	if (function)
+		_ReportError(declaration, "Cannot declare a struct within a function!");
+
+	RootNode* body = declaration->Body();
+
+	std::map<std::string, size_t> names;
+
+	for (size_t index = 0; index < body->Children(); index++)
+	{
+		Node*       statement = (*body)[index];
+		std::string name      = "";
+
+		if (statement->Type() == NodeType::FUNCTION)
+		{
+			name = static_cast<IdentifierNode*>(static_cast<FunctionDeclaration*>(statement)->Identifier())->Value();
+
+			// Member functions are checked the same as
+			// any function declared outside of one
+			_CheckFunctionDeclaration(static_cast<FunctionDeclaration*>(statement), false);
+		}
+		else if (
+			statement->Type() == NodeType::ASSIGN &&
+			static_cast<AssignmentNode*>(statement)->GetIdentifier()->Type() == NodeType::IDENTIFIER
+		)
+		{
+			name = static_cast<IdentifierNode*>(static_cast<AssignmentNode*>(statement)->GetIdentifier())->Value();
+
+			_CheckNode(statement, false);
+		}
+		else
+		{
+			_ReportError(statement, "Only fields and member functions can be declared within a struct!");
+
+			continue;
+		}
+
+		if (++names[name] == 2)
+			_ReportError(statement, "Member \"" + name + "\" is declared more than once within a struct!");
+	}
+}
+
+void ASTChecker::_CheckForStatement(ForStatement* statement)
+{
+	_CheckLoopVariable(
+		statement->Body(),
+		static_cast<IdentifierNode*>(statement->Identifier())->Value()
+	);
+}
+
+void ASTChecker::_CheckLoopVariable(
+	Node*              node,
+	const std::string& identifier
+)
+{
+	// Functions and structs have variables of their own,
+	// while a loop within this one by the same name is
+	// checked on its own
+	if (
+		node->Type() == NodeType::FUNCTION           ||
+		node->Type() == NodeType::STRUCT_DECLARATION ||
+		(node->Type() == NodeType::FOR_STATEMENT &&
+		 static_cast<IdentifierNode*>(static_cast<ForStatement*>(node)->Identifier())->Value() == identifier)
+	)
+		return;
+
+	if (node->Type() == NodeType::ASSIGN)
+	{
+		const std::string* variable = WrittenVariable(static_cast<AssignmentNode*>(node)->GetIdentifier());
+
+		if (variable && *variable == identifier)
+			_ReportError(node, "Cannot assign to \"" + identifier + "\", as it is the variable of a for loop!");
+	}
+
+	node->VisitChildren([this, &identifier](Node*& child) {
+		_CheckLoopVariable(child, identifier);
+	});
+}
+
+void ASTChecker::_CheckFunctionCall(FunctionCall* call)
+{
+	// Built-in calls check their own arguments, and
+	// member functions depend on the instance called
+	if (
+		call->Flags() != CallFlags::NONE ||
+		call->Identifier()->Type() != NodeType::IDENTIFIER
+	)
+		return;
+
+	const std::string& identifier = static_cast<IdentifierNode*>(call->Identifier())->Value();
+
+	// If the function is declared or assigned more
+	// than once, which declaration is called can only
+	// be known at runtime, so leave it to the interpreter
+	auto definitions = m_definitions.find(identifier);
+	auto find        = m_declarations.find(identifier);
+
+	if (definitions == m_definitions.end() || definitions->second != 1 || find == m_declarations.end())
+		return;
+
+	FunctionDeclaration* declaration = find->second;
+
+	if (declaration->Arguments().size() != call->Arguments().size())
+	{
+		_ReportError(
+			call,
+			"Mismatched argument sizes for \"" + identifier + "\"! Expected: " +
+			std::to_string(declaration->Arguments().size()) + "; Got: " +
+			std::to_string(call->Arguments().size()) + "!"
+		);
+
+		return;
+	}
+
+	call->ArgumentsChecked(true);
+}
+
+void ASTChecker::_MarkPureFunctions()
+{
+	// Only functions declared once are known to be
+	// the function called by their name
+	std::vector<FunctionDeclaration*> candidates;
+
+	for (auto& declaration : m_declarations)
+	{
+		if (m_definitions[declaration.first] != 1)
+			continue;
+
+		declaration.second->Pure(true);
+		candidates.push_back(declaration.second);
+	}
+
+	// Finding one impure function can make any function
+	// calling it impure, so keep going until nothing changes
+	bool changed = true;
+
+	while (changed)
+	{
+		changed = false;
+
+		for (FunctionDeclaration* declaration : candidates)
+		{
+			if (declaration->Pure() && !_IsPure(declaration->Body(), declaration))
+			{
+				declaration->Pure(false);
+
+				changed = true;
+			}
+		}
+	}
+}
+
+bool ASTChecker::_IsPure(
+	Node*                node,
+	FunctionDeclaration* declaration
+)
+{
+	if (node->Type() == NodeType::ASSIGN)
+	{
+		AssignmentNode* assign = static_cast<AssignmentNode*>(node);
+
+		// Assigning to an element or a member changes
+		// an array, map, or struct in place
+		if (
+			assign->GetIdentifier()->Type() != NodeType::IDENTIFIER ||
+			!_IsLocal(static_cast<IdentifierNode*>(assign->GetIdentifier())->Value(), declaration)
+		)
+			return false;
+
+		return _IsPure(assign->GetAssignment(), declaration);
+	}
+	else if (node->Type() == NodeType::CALL)
+	{
+		FunctionCall* call = static_cast<FunctionCall*>(node);
+
+		if (
+			call->Flags() == CallFlags::PRINT           ||
+			call->Flags() == CallFlags::PUSH_COLLECTION ||
+			call->Flags() == CallFlags::POP_COLLECTION
+		)
+			return false;
+
+		// Member functions may change the instance they
+		// are called on, so only plain functions are allowed
+		if (call->Flags() == CallFlags::NONE)
+		{
+			if (call->Identifier()->Type() != NodeType::IDENTIFIER)
+				return false;
+
+			const std::string& identifier = static_cast<IdentifierNode*>(call->Identifier())->Value();
+
+			auto definitions = m_definitions.find(identifier);
+			auto find        = m_declarations.find(identifier);
+
+			if (
+				definitions == m_definitions.end() ||
+				definitions->second != 1           ||
+				find == m_declarations.end()       ||
+				!find->second->Pure()
+			)
+				return false;
+		}
+
+		for (size_t index = 0; index < call->Arguments().size(); index++)
+			if (!_IsPure(call->Arguments()[index], declaration))
+				return false;
+
+		return true;
+	}
+	else if (node->Type() == NodeType::IDENTIFIER)
+		return _IsLocal(static_cast<IdentifierNode*>(node)->Value(), declaration);
+	else if (node->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+	{
+		if (!_IsLocal(static_cast<ArrayElementIdentifierNode*>(node)->ArrayIdentifier(), declaration))
+			return false;
+	}
+
+	bool pure = true;
+
+	node->VisitChildren([this, declaration, &pure](Node*& child) {
+		if (pure)
+			pure = _IsPure(child, declaration);
+	});
+
+	return pure;
+}
+
+bool ASTChecker::_IsLocal(
+	const std::string&   identifier,
+	FunctionDeclaration* declaration
+)
+{
+	for (size_t index = 0; index < declaration->Arguments().size(); index++)
+		if (static_cast<IdentifierNode*>(declaration->Arguments()[index])->Value() == identifier)
+			return true;
+
+	// Anything else is a variable of the function,
+	// unless a variable outside of one shares its name
+	return identifier != SHAKARA_CMD_ARGS_NAME &&
+		m_globalDefinitions.find(identifier) == m_globalDefinitions.end();
+}
+
+void ASTChecker::_ReportError(
+	Node*              node,
+	const std::string& message
+)
+{
+	std::cerr << "Checker Error! " << message << std::endl;
+	std::cerr << "Line: " << node->Line() << "; Column: " << node->Column() << std::endl;
+
+	m_errors++;
+}
\ No newline at end of file
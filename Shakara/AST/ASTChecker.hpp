@@ -0,0 +1,186 @@
+#pragma once
+
+namespace Shakara
+{
+	namespace AST
+	{
+		class Node;
+
+		class RootNode;
+
+		class FunctionCall;
+
+		class FunctionDeclaration;
+
+		class StructDeclaration;
+
+		class ForStatement;
+
+		/**
+		 * Semantic checker for a built AST.
+		 *
+		 * Validates everything that only depends on
+		 * the structure of the program, such as where
+		 * functions are declared and where returns are
+		 * made, before anything is executed.
+		 *
+		 * Each error is reported only once, with the
+		 * line and column it was found at, so that the
+		 * interpreter doesn't have to check for them
+		 * on every execution.
+		 */
+		class ASTChecker
+		{
+		public:
+			/**
+			 * Callback to be ran once after checking,
+			 * if any errors were found.
+			 */
+			void ErrorHandler(std::function<void()> handler)
+			{
+				m_errorHandle = handler;
+			}
+
+			/**
+			 * Check the AST under the passed in root.
+			 *
+			 * Returns true if no errors were found, and
+			 * the AST is safe to be executed.
+			 */
+			bool Check(RootNode* root);
+
+		private:
+			/**
+			 * Callback function to be used for
+			 * error handling
+			 */
+			std::function<void()>                       m_errorHandle;
+
+			/**
+			 * Amount of errors found in the current check
+			 */
+			size_t                                      m_errors = 0;
+
+			/**
+			 * Function declarations made outside of a function
+			 * body, mapped by their identifier.
+			 */
+			std::map<std::string, FunctionDeclaration*> m_declarations;
+
+			/**
+			 * The amount of times each identifier is declared
+			 * or assigned to anywhere within the AST.
+			 *
+			 * A function is only statically known if it is
+			 * defined exactly once.
+			 */
+			std::map<std::string, size_t>               m_definitions;
+
+			/**
+			 * The amount of times each identifier is declared
+			 * or assigned to outside of a function body, which
+			 * a function assigning to it would change.
+			 */
+			std::map<std::string, size_t>               m_globalDefinitions;
+
+			/**
+			 * How many loops the node being checked is
+			 * nested within, inside of the function body
+			 * holding it if there is one.
+			 */
+			size_t                                      m_loops = 0;
+
+			/**
+			 * Walk a node and its children, recording every
+			 * function declaration and identifier assignment.
+			 */
+			void _CollectDefinitions(Node* node, bool function);
+
+			/**
+			 * Walk a node and its children, checking each
+			 * node for errors.
+			 *
+			 * The function argument is whether or not the
+			 * node is within a function body.
+			 */
+			void _CheckNode(Node* node, bool function);
+
+			/**
+			 * Check the signature and body of a function
+			 * declaration.
+			 */
+			void _CheckFunctionDeclaration(
+				FunctionDeclaration* declaration,
+				bool                 function
+			);
+
+			/**
+			 * Check that a struct declaration is only made
+			 * of fields and member functions, each with a
+			 * name of its own.
+			 */
+			void _CheckStructDeclaration(
+				StructDeclaration* declaration,
+				bool               function
+			);
+
+			/**
+			 * Check that nothing within the body of a for
+			 * loop assigns to the variable of the loop,
+			 * which only the loop itself may change.
+			 */
+			void _CheckForStatement(ForStatement* statement);
+
+			/**
+			 * Report each assignment to the identifier
+			 * within a node and its children.
+			 */
+			void _CheckLoopVariable(
+				Node*              node,
+				const std::string& identifier
+			);
+
+			/**
+			 * Compare the arguments of a call against the
+			 * declaration of the called function, if that
+			 * declaration is statically known.
+			 */
+			void _CheckFunctionCall(FunctionCall* call);
+
+			/**
+			 * Mark each statically known function as pure
+			 * or not, assuming they all are at first, until
+			 * no function is found to call an impure one.
+			 */
+			void _MarkPureFunctions();
+
+			/**
+			 * Whether a node within the body of the declaration
+			 * and each of its children are pure.
+			 */
+			bool _IsPure(
+				Node*                node,
+				FunctionDeclaration* declaration
+			);
+
+			/**
+			 * Whether an identifier used within a function can
+			 * only ever be one of its arguments or variables.
+			 */
+			bool _IsLocal(
+				const std::string&   identifier,
+				FunctionDeclaration* declaration
+			);
+
+			/**
+			 * Print an error with the position of the
+			 * node that caused it.
+			 */
+			void _ReportError(
+				Node*              node,
+				const std::string& message
+			);
+
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,293 @@
+#include "../stdafx.hpp"
+#include "ASTHoister.hpp"
+
+#include "ASTTypes.hpp"
+#include "ASTNode.hpp"
+#include "Nodes/ASTIdentifierNode.hpp"
+#include "Nodes/ASTRootNode.hpp"
+#include "Nodes/ASTFunctionDeclarationNode.hpp"
+#include "Nodes/ASTStructDeclarationNode.hpp"
+#include "Nodes/ASTFunctionCallNode.hpp"
+#include "Nodes/ASTAssignmentNode.hpp"
+#include "Nodes/ASTBinaryOperation.hpp"
+#include "Nodes/ASTWhileStatementNode.hpp"
+#include "Nodes/ASTForStatementNode.hpp"
+#include "Nodes/ASTArrayElementIdentifier.hpp"
+#include "Nodes/ASTMemberIdentifier.hpp"
+
+using namespace Shakara;
+using namespace Shakara::AST;
+
+static bool IsLiteral(Node* node)
+{
+	return node->Type() == NodeType::INTEGER ||
+		node->Type() == NodeType::DECIMAL ||
+		node->Type() == NodeType::STRING  ||
+		node->Type() == NodeType::BOOLEAN;
+}
+
+/**
+ * Grab the name of the variable that would be
+ * changed by writing to the passed in node, or
+ * nullptr if it isn't a variable at all
+ */
+static const std::string* WrittenVariable(Node* node)
+{
+	// Members are stored within the instance,
+	// which is stored within a variable
+	while (node->Type() == NodeType::MEMBER_IDENTIFIER)
+		node = static_cast<MemberIdentifierNode*>(node)->Object();
+
+	if (node->Type() == NodeType::IDENTIFIER)
+		return &static_cast<IdentifierNode*>(node)->Value();
+	else if (node->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+		return &static_cast<ArrayElementIdentifierNode*>(node)->ArrayIdentifier();
+
+	return nullptr;
+}
+
+static WhileStatement* HoistedLoop(Node* node)
+{
+	if (node->Type() == NodeType::CALL)
+		return static_cast<FunctionCall*>(node)->HoistedLoop();
+	else if (node->Type() == NodeType::BINARY_OP || node->Type() == NodeType::LOGICAL_OP)
+		return static_cast<BinaryOperation*>(node)->HoistedLoop();
+
+	return nullptr;
+}
+
+size_t ASTHoister::Hoist(RootNode* root)
+{
+	m_hoisted = 0;
+
+	m_declarations.clear();
+
+	_CollectFunctions(root, false);
+
+	_HoistNode(root);
+
+	return m_hoisted;
+}
+
+void ASTHoister::_CollectFunctions(Node* node, bool function)
+{
+	if (node->Type() == NodeType::FUNCTION)
+	{
+		FunctionDeclaration* declaration = static_cast<FunctionDeclaration*>(node);
+
+		if (!function)
+			m_declarations[static_cast<IdentifierNode*>(declaration->Identifier())->Value()] = declaration;
+
+		_CollectFunctions(declaration->Body(), true);
+
+		return;
+	}
+
+	node->VisitChildren([this, function](Node*& child) {
+		_CollectFunctions(child, function);
+	});
+}
+
+void ASTHoister::_HoistNode(Node* node)
+{
+	if (node->Type() == NodeType::WHILE_STATEMENT)
+		_HoistLoop(static_cast<WhileStatement*>(node));
+
+	node->VisitChildren([this](Node*& child) {
+		_HoistNode(child);
+	});
+}
+
+void ASTHoister::_HoistLoop(WhileStatement* loop)
+{
+	// Already hoisted out of, if the AST
+	// has been hoisted before
+	if (loop->Hoisted() > 0)
+		return;
+
+	std::map<std::string, size_t> writes;
+
+	if (!_CollectWrites(loop, writes))
+		return;
+
+	_MarkInvariants(loop, loop, writes, false);
+
+	m_hoisted += loop->Hoisted();
+}
+
+bool ASTHoister::_CollectWrites(
+	Node*                          node,
+	std::map<std::string, size_t>& writes
+)
+{
+	// Declaring a function or struct only assigns it
+	// to its name, the body isn't ran until called
+	if (node->Type() == NodeType::FUNCTION)
+	{
+		writes[static_cast<IdentifierNode*>(static_cast<FunctionDeclaration*>(node)->Identifier())->Value()]++;
+
+		return true;
+	}
+	else if (node->Type() == NodeType::STRUCT_DECLARATION)
+	{
+		writes[static_cast<IdentifierNode*>(static_cast<StructDeclaration*>(node)->Identifier())->Value()]++;
+
+		return true;
+	}
+	else if (node->Type() == NodeType::ASSIGN)
+	{
+		const std::string* variable = WrittenVariable(static_cast<AssignmentNode*>(node)->GetIdentifier());
+
+		if (!variable)
+			return false;
+
+		writes[*variable]++;
+	}
+	else if (node->Type() == NodeType::FOR_STATEMENT)
+		writes[static_cast<IdentifierNode*>(static_cast<ForStatement*>(node)->Identifier())->Value()]++;
+	else if (node->Type() == NodeType::CALL)
+	{
+		FunctionCall* call = static_cast<FunctionCall*>(node);
+
+		if (
+			call->Flags() == CallFlags::PUSH_COLLECTION ||
+			call->Flags() == CallFlags::POP_COLLECTION
+		)
+		{
+			if (call->Arguments().empty())
+				return false;
+
+			const std::string* variable = WrittenVariable(call->Arguments()[0]);
+
+			if (variable)
+				writes[*variable]++;
+		}
+		else if (call->Flags() == CallFlags::NONE && !_CallsPureFunction(call))
+			return false;
+	}
+
+	bool known = true;
+
+	node->VisitChildren([this, &writes, &known](Node*& child) {
+		if (known)
+			known = _CollectWrites(child, writes);
+	});
+
+	return known;
+}
+
+bool ASTHoister::_CallsPureFunction(Node* node)
+{
+	FunctionCall* call = static_cast<FunctionCall*>(node);
+
+	// Member functions may change the instance
+	// they are called on
+	if (call->Identifier()->Type() != NodeType::IDENTIFIER)
+		return false;
+
+	// A function is only marked pure if it is the one
+	// definition of its name anywhere within the AST
+	auto find = m_declarations.find(static_cast<IdentifierNode*>(call->Identifier())->Value());
+
+	return find != m_declarations.end() && find->second->Pure();
+}
+
+bool ASTHoister::_Invariant(
+	Node*                                node,
+	const std::map<std::string, size_t>& writes
+)
+{
+	if (IsLiteral(node))
+		return true;
+	else if (node->Type() == NodeType::IDENTIFIER)
+		return writes.find(static_cast<IdentifierNode*>(node)->Value()) == writes.end();
+	else if (node->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+	{
+		if (writes.find(static_cast<ArrayElementIdentifierNode*>(node)->ArrayIdentifier()) != writes.end())
+			return false;
+	}
+	else if (node->Type() == NodeType::CALL)
+	{
+		FunctionCall* call = static_cast<FunctionCall*>(node);
+
+		// Calls in tail position are ran in place of the
+		// frame returning them, rather than evaluated
+		if (
+			call->Flags() == CallFlags::PRINT           ||
+			call->Flags() == CallFlags::PUSH_COLLECTION ||
+			call->Flags() == CallFlags::POP_COLLECTION  ||
+			call->TailCall()
+		)
+			return false;
+
+		if (call->Flags() == CallFlags::NONE && !_CallsPureFunction(call))
+			return false;
+
+		for (size_t index = 0; index < call->Arguments().size(); index++)
+			if (!_Invariant(call->Arguments()[index], writes))
+				return false;
+
+		return true;
+	}
+	else if (
+		node->Type() != NodeType::BINARY_OP  &&
+		node->Type() != NodeType::LOGICAL_OP &&
+		node->Type() != NodeType::MEMBER_IDENTIFIER
+	)
+		return false;
+
+	bool invariant = true;
+
+	node->VisitChildren([this, &writes, &invariant](Node*& child) {
+		if (invariant)
+			invariant = _Invariant(child, writes);
+	});
+
+	return invariant;
+}
+
+void ASTHoister::_MarkInvariants(
+	Node*                                node,
+	WhileStatement*                      loop,
+	const std::map<std::string, size_t>& writes,
+	bool                                 statement
+)
+{
+	if (
+		node->Type() == NodeType::FUNCTION ||
+		node->Type() == NodeType::STRUCT_DECLARATION
+	)
+		return;
+
+	// Hoisted out of a loop this one is within
+	if (HoistedLoop(node))
+		return;
+
+	// Calls made as a statement have their value thrown
+	// away, so there would be nothing to reuse
+	if (
+		(node->Type() == NodeType::BINARY_OP  ||
+		 node->Type() == NodeType::LOGICAL_OP ||
+		 node->Type() == NodeType::CALL)      &&
+		!statement                            &&
+		_Invariant(node, writes)
+	)
+	{
+		size_t slot = loop->Hoisted();
+
+		if (node->Type() == NodeType::CALL)
+			static_cast<FunctionCall*>(node)->Hoist(loop, slot);
+		else
+			static_cast<BinaryOperation*>(node)->Hoist(loop, slot);
+
+		loop->Hoisted(slot + 1);
+
+		return;
+	}
+
+	bool body = node->Type() == NodeType::ROOT;
+
+	node->VisitChildren([this, loop, &writes, body](Node*& child) {
+		_MarkInvariants(child, loop, writes, body);
+	});
+}
\ No newline at end of file
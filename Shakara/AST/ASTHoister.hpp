@@ -0,0 +1,112 @@
+#pragma once
+
+namespace Shakara
+{
+	namespace AST
+	{
+		class Node;
+
+		class RootNode;
+
+		class WhileStatement;
+
+		class FunctionDeclaration;
+
+		/**
+		 * Hoists expressions which never change while
+		 * a loop runs out of each iteration of it, within
+		 * a checked AST.
+		 *
+		 * An expression never changes if it only reads
+		 * variables the loop doesn't write to, and only
+		 * calls built-ins and pure functions. Loops calling
+		 * anything else are left alone, as the call could
+		 * change any variable.
+		 *
+		 * Hoisted expressions are still only evaluated when
+		 * first reached, once for each run of the loop, so
+		 * anything they report is reported the same as before.
+		 */
+		class ASTHoister
+		{
+		public:
+			/**
+			 * Hoist each expression under the passed in
+			 * root that can be, returning how many were.
+			 */
+			size_t Hoist(RootNode* root);
+
+		private:
+			/**
+			 * Functions declared outside of a function body,
+			 * mapped by their identifier.
+			 */
+			std::map<std::string, FunctionDeclaration*> m_declarations;
+
+			/**
+			 * Amount of expressions hoisted in the current pass
+			 */
+			size_t                                      m_hoisted = 0;
+
+			/**
+			 * Walk a node and its children, recording every
+			 * function declared outside of a function.
+			 */
+			void _CollectFunctions(Node* node, bool function);
+
+			/**
+			 * Walk a node and its children, hoisting out of
+			 * each loop found, outer loops first so that an
+			 * expression is hoisted as far out as it can be.
+			 */
+			void _HoistNode(Node* node);
+
+			/**
+			 * Hoist every expression of a loop that can be,
+			 * if nothing within the loop can change variables
+			 * without it being known which.
+			 */
+			void _HoistLoop(WhileStatement* loop);
+
+			/**
+			 * Record each variable written to within a node,
+			 * returning false if anything could write to a
+			 * variable that isn't known.
+			 */
+			bool _CollectWrites(
+				Node*                          node,
+				std::map<std::string, size_t>& writes
+			);
+
+			/**
+			 * Whether a call is to a pure function, which
+			 * always returns the same value for the same
+			 * arguments and changes nothing.
+			 */
+			bool _CallsPureFunction(Node* node);
+
+			/**
+			 * Whether an expression evaluates to the same
+			 * value for every iteration of a loop writing
+			 * to the passed in variables.
+			 */
+			bool _Invariant(
+				Node*                                node,
+				const std::map<std::string, size_t>& writes
+			);
+
+			/**
+			 * Walk a node and its children, marking each
+			 * largest expression that never changes as
+			 * hoisted out of the loop.
+			 */
+			void _MarkInvariants(
+				Node*                                node,
+				WhileStatement*                      loop,
+				const std::map<std::string, size_t>& writes,
+				bool                                 statement
+			);
+
+		};
+	}
+}
\ No newline at end of file
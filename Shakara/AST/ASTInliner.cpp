@@ -0,0 +1,366 @@
+#include "../stdafx.hpp"
+#include "ASTInliner.hpp"
+
+#include "ASTTypes.hpp"
+#include "ASTNode.hpp"
+#include "Nodes/ASTIdentifierNode.hpp"
+#include "Nodes/ASTRootNode.hpp"
+#include "Nodes/ASTReturnNode.hpp"
+#include "Nodes/ASTFunctionDeclarationNode.hpp"
+#include "Nodes/ASTFunctionCallNode.hpp"
+#include "Nodes/ASTAssignmentNode.hpp"
+#include "Nodes/ASTArrayElementIdentifier.hpp"
+
+using namespace Shakara;
+using namespace Shakara::AST;
+
+static const size_t NO_ARGUMENT = static_cast<size_t>(-1);
+
+/**
+ * Grab the index of the argument of a function
+ * with the identifier passed in, if it has one
+ */
+static size_t ArgumentIndex(FunctionDeclaration* declaration, const std::string& identifier)
+{
+	for (size_t index = 0; index < declaration->Arguments().size(); index++)
+		if (static_cast<IdentifierNode*>(declaration->Arguments()[index])->Value() == identifier)
+			return index;
+
+	return NO_ARGUMENT;
+}
+
+static bool IsLiteral(Node* node)
+{
+	return node->Type() == NodeType::INTEGER ||
+		node->Type() == NodeType::DECIMAL ||
+		node->Type() == NodeType::STRING  ||
+		node->Type() == NodeType::BOOLEAN;
+}
+
+size_t ASTInliner::Inline(RootNode* root)
+{
+	m_inlined = 0;
+
+	m_declarations.clear();
+	m_expressions.clear();
+	m_globals.clear();
+
+	// Find every function first, as calls can be
+	// made before the function is declared
+	_CollectFunctions(root, false);
+
+	if (!m_expressions.empty())
+		_InlineNode(root);
+
+	return m_inlined;
+}
+
+void ASTInliner::_CollectFunctions(Node* node, bool function)
+{
+	if (node->Type() == NodeType::FUNCTION)
+	{
+		if (function)
+			return;
+
+		FunctionDeclaration* declaration = static_cast<FunctionDeclaration*>(node);
+		RootNode*            body        = static_cast<RootNode*>(declaration->Body());
+
+		const std::string& identifier = static_cast<IdentifierNode*>(declaration->Identifier())->Value();
+
+		// Only the last declaration is inlined, leaving any
+		// other to be called the same as before
+		m_declarations[identifier] = declaration;
+		m_expressions.erase(identifier);
+
+		if (body->Children() != 1 || (*body)[0]->Type() != NodeType::RETURN)
+			return;
+
+		Node*  expression = static_cast<ReturnNode*>((*body)[0])->GetReturned();
+		size_t size       = _ExpressionSize(expression, declaration);
+
+		if (size > 0 && size <= MAX_INLINE_NODES)
+			m_expressions[identifier] = expression;
+
+		return;
+	}
+
+	// Member functions are only called through
+	// an instance, so they are never inlined
+	if (node->Type() == NodeType::STRUCT_DECLARATION)
+		return;
+
+	if (node->Type() == NodeType::ASSIGN && !function)
+	{
+		Node* identifier = static_cast<AssignmentNode*>(node)->GetIdentifier();
+
+		if (identifier->Type() == NodeType::IDENTIFIER)
+			m_globals[static_cast<IdentifierNode*>(identifier)->Value()]++;
+	}
+
+	node->VisitChildren([this, function](Node*& child) {
+		_CollectFunctions(child, function);
+	});
+}
+
+void ASTInliner::_InlineNode(Node* node)
+{
+	node->VisitChildren([this](Node*& child) {
+		_InlineNode(child);
+	});
+
+	if (node->Type() == NodeType::CALL)
+		_InlineCall(static_cast<FunctionCall*>(node));
+}
+
+void ASTInliner::_InlineCall(FunctionCall* call)
+{
+	if (
+		call->Flags() != CallFlags::NONE ||
+		call->Identifier()->Type() != NodeType::IDENTIFIER
+	)
+		return;
+
+	const std::string& identifier = static_cast<IdentifierNode*>(call->Identifier())->Value();
+
+	auto find = m_expressions.find(identifier);
+
+	if (find == m_expressions.end())
+		return;
+
+	FunctionDeclaration* declaration = m_declarations[identifier];
+	Node*                expression  = find->second;
+
+	if (declaration->Arguments().size() != call->Arguments().size())
+		return;
+
+	for (size_t index = 0; index < call->Arguments().size(); index++)
+	{
+		Node* argument = call->Arguments()[index];
+
+		const std::string& name = static_cast<IdentifierNode*>(declaration->Arguments()[index])->Value();
+
+		// Calling would report the argument as already
+		// existing, so leave the call to do so
+		if (m_globals.find(name) != m_globals.end())
+			return;
+
+		if (!_Substitutable(argument))
+			return;
+
+		// Anything more than a variable or a literal would
+		// be evaluated again for each use, so only inline
+		// it if the function uses it once at most
+
+		if (
+			argument->Type() != NodeType::IDENTIFIER &&
+			!IsLiteral(argument) &&
+			_CountUses(expression, name) > 1
+		)
+			return;
+	}
+
+	Node* inlined = expression->Clone();
+
+	if (!_Substitute(inlined, declaration, call))
+	{
+		delete inlined;
+
+		return;
+	}
+
+	inlined->Parent(call);
+	call->Inline(inlined, declaration);
+
+	m_inlined++;
+}
+
+size_t ASTInliner::_ExpressionSize(
+	Node*                node,
+	FunctionDeclaration* declaration
+)
+{
+	if (IsLiteral(node))
+		return 1;
+	else if (node->Type() == NodeType::IDENTIFIER)
+	{
+		// Anything other than an argument would be looked
+		// up within the scope of the caller once inlined
+		return (ArgumentIndex(declaration, static_cast<IdentifierNode*>(node)->Value()) != NO_ARGUMENT) ? 1 : 0;
+	}
+	else if (node->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+	{
+		if (ArgumentIndex(declaration, static_cast<ArrayElementIdentifierNode*>(node)->ArrayIdentifier()) == NO_ARGUMENT)
+			return 0;
+	}
+	else if (node->Type() == NodeType::CALL)
+	{
+		FunctionCall* call = static_cast<FunctionCall*>(node);
+
+		// Calls to other functions are left to be made,
+		// and calls changing an argument would change the
+		// caller's variable rather than a copy of it
+		if (
+			call->Flags() == CallFlags::NONE            ||
+			call->Flags() == CallFlags::PRINT           ||
+			call->Flags() == CallFlags::PUSH_COLLECTION ||
+			call->Flags() == CallFlags::POP_COLLECTION
+		)
+			return 0;
+
+		size_t size = 1;
+
+		for (size_t index = 0; index < call->Arguments().size(); index++)
+		{
+			size_t argument = _ExpressionSize(call->Arguments()[index], declaration);
+
+			if (argument == 0)
+				return 0;
+
+			size += argument;
+		}
+
+		return size;
+	}
+	else if (
+		node->Type() != NodeType::BINARY_OP  &&
+		node->Type() != NodeType::LOGICAL_OP &&
+		node->Type() != NodeType::MEMBER_IDENTIFIER
+	)
+		return 0;
+
+	size_t size      = 1;
+	bool   inlinable = true;
+
+	node->VisitChildren([this, declaration, &size, &inlinable](Node*& child) {
+		size_t childSize = _ExpressionSize(child, declaration);
+
+		if (childSize == 0)
+			inlinable = false;
+
+		size += childSize;
+	});
+
+	return (inlinable) ? size : 0;
+}
+
+size_t ASTInliner::_CountUses(
+	Node*              node,
+	const std::string& argument
+)
+{
+	if (node->Type() == NodeType::IDENTIFIER)
+		return (static_cast<IdentifierNode*>(node)->Value() == argument) ? 1 : 0;
+
+	size_t uses = 0;
+
+	if (
+		node->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER &&
+		static_cast<ArrayElementIdentifierNode*>(node)->ArrayIdentifier() == argument
+	)
+		uses++;
+
+	// The identifier of a built-in call is its name,
+	// so only look through its arguments
+	if (node->Type() == NodeType::CALL)
+	{
+		FunctionCall* call = static_cast<FunctionCall*>(node);
+
+		for (size_t index = 0; index < call->Arguments().size(); index++)
+			uses += _CountUses(call->Arguments()[index], argument);
+
+		return uses;
+	}
+
+	node->VisitChildren([this, &argument, &uses](Node*& child) {
+		uses += _CountUses(child, argument);
+	});
+
+	return uses;
+}
+
+bool ASTInliner::_Substitutable(Node* node)
+{
+	if (IsLiteral(node) || node->Type() == NodeType::IDENTIFIER)
+		return true;
+
+	// Calls could do anything, and literal arrays and maps
+	// are made fresh each time, so only allow expressions
+	// reading values
+	if (
+		node->Type() != NodeType::BINARY_OP                &&
+		node->Type() != NodeType::LOGICAL_OP               &&
+		node->Type() != NodeType::ARRAY_ELEMENT_IDENTIFIER &&
+		node->Type() != NodeType::MEMBER_IDENTIFIER
+	)
+		return false;
+
+	bool substitutable = true;
+
+	node->VisitChildren([this, &substitutable](Node*& child) {
+		if (substitutable)
+			substitutable = _Substitutable(child);
+	});
+
+	return substitutable;
+}
+
+bool ASTInliner::_Substitute(
+	Node*&               node,
+	FunctionDeclaration* declaration,
+	FunctionCall*        call
+)
+{
+	if (node->Type() == NodeType::IDENTIFIER)
+	{
+		size_t index = ArgumentIndex(declaration, static_cast<IdentifierNode*>(node)->Value());
+
+		if (index != NO_ARGUMENT)
+		{
+			Node* value = call->Arguments()[index]->Clone();
+			value->Parent(node->Parent());
+
+			delete node;
+			node = value;
+		}
+
+		return true;
+	}
+
+	if (node->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+	{
+		ArrayElementIdentifierNode* element = static_cast<ArrayElementIdentifierNode*>(node);
+
+		size_t index = ArgumentIndex(declaration, element->ArrayIdentifier());
+
+		// Elements are looked up by the name of the array,
+		// so the argument has to be a variable as well
+		if (index != NO_ARGUMENT)
+		{
+			Node* value = call->Arguments()[index];
+
+			if (value->Type() != NodeType::IDENTIFIER)
+				return false;
+
+			element->ArrayIdentifier(static_cast<IdentifierNode*>(value)->Value());
+		}
+	}
+
+	bool substituted = true;
+
+	if (node->Type() == NodeType::CALL)
+	{
+		FunctionCall* builtIn = static_cast<FunctionCall*>(node);
+
+		for (size_t index = 0; index < builtIn->Arguments().size() && substituted; index++)
+			substituted = _Substitute(builtIn->Arguments()[index], declaration, call);
+
+		return substituted;
+	}
+
+	node->VisitChildren([this, declaration, call, &substituted](Node*& child) {
+		if (substituted)
+			substituted = _Substitute(child, declaration, call);
+	});
+
+	return substituted;
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+namespace Shakara
+{
+	namespace AST
+	{
+		class Node;
+
+		class RootNode;
+
+		class FunctionCall;
+
+		class FunctionDeclaration;
+
+		/**
+		 * Inlines calls to small functions within a
+		 * checked AST.
+		 *
+		 * A function is small if its body only returns
+		 * an expression made of its arguments, literals,
+		 * and built-in calls that don't change anything.
+		 * Each call to one is given a copy of that
+		 * expression with the arguments of the call in
+		 * place of the function's own.
+		 *
+		 * Functions can be declared again while running,
+		 * so the interpreter only uses the inlined copy
+		 * while the declaration inlined is the one called.
+		 */
+		class ASTInliner
+		{
+		public:
+			/**
+			 * The most nodes a returned expression can be
+			 * made of for its function to be inlined.
+			 */
+			static const size_t MAX_INLINE_NODES = 16;
+
+			/**
+			 * Inline each call under the passed in root
+			 * that can be, returning how many were.
+			 */
+			size_t Inline(RootNode* root);
+
+		private:
+			/**
+			 * Functions declared outside of a function body,
+			 * mapped by their identifier, along with the
+			 * expression each returns if they're small.
+			 */
+			std::map<std::string, FunctionDeclaration*> m_declarations;
+			std::map<std::string, Node*>                m_expressions;
+
+			/**
+			 * Identifiers assigned to outside of a function
+			 * body, which a function can't have an argument
+			 * named after.
+			 */
+			std::map<std::string, size_t>               m_globals;
+
+			/**
+			 * Amount of calls inlined in the current pass
+			 */
+			size_t                                      m_inlined = 0;
+
+			/**
+			 * Walk a node and its children, recording every
+			 * small function declared outside of a function,
+			 * and every variable assigned to outside of one.
+			 */
+			void _CollectFunctions(Node* node, bool function);
+
+			/**
+			 * Walk a node and its children, inlining each
+			 * call to a small function.
+			 */
+			void _InlineNode(Node* node);
+
+			/**
+			 * Inline a single call, if its arguments can
+			 * be substituted into the function's expression.
+			 */
+			void _InlineCall(FunctionCall* call);
+
+			/**
+			 * Count the nodes within an expression, or zero
+			 * if it can't be inlined at all.
+			 */
+			size_t _ExpressionSize(
+				Node*                node,
+				FunctionDeclaration* declaration
+			);
+
+			/**
+			 * Count the uses of an argument of the function
+			 * within an expression.
+			 */
+			size_t _CountUses(
+				Node*              node,
+				const std::string& argument
+			);
+
+			/**
+			 * Whether a node of a call can be substituted
+			 * into an expression in place of an argument,
+			 * without changing when anything is ran.
+			 */
+			bool _Substitutable(Node* node);
+
+			/**
+			 * Replace each use of an argument of the function
+			 * within a copied expression with a copy of the
+			 * argument the call was made with, all at once so
+			 * that nothing substituted is substituted again.
+			 *
+			 * Returns false if an argument can't be used
+			 * where the function uses its own.
+			 */
+			bool _Substitute(
+				Node*&               node,
+				FunctionDeclaration* declaration,
+				FunctionCall*        call
+			);
+
+		};
+	}
+}
\ No newline at end of file
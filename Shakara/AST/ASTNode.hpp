@@ -43,8 +43,36 @@ namespace Shakara
 				return m_type;
 			}
 
+			/**
+			 * Set the line and column of the token
+			 * this node was built from, used for
+			 * reporting errors back to the user.
+			 */
+			inline Node& Position(uint32_t line, uint32_t column)
+			{
+				m_line   = line;
+				m_column = column;
+
+				return *this;
+			}
+
+			inline uint32_t Line() const
+			{
+				return m_line;
+			}
+
+			inline uint32_t Column() const
+			{
+				return m_column;
+			}
+
 			inline void MarkDelete(bool state)
 			{
+				// Immortal nodes are shared, and thus
+				// can never be temporary
+				if (m_immortal)
+					return;
+
 				m_markDelete = state;
 			}
 
@@ -53,16 +81,46 @@ namespace Shakara
 				return m_markDelete;
 			}
 
+			inline void Immortal(bool state)
+			{
+				m_immortal = state;
+			}
+
+			inline bool Immortal() const
+			{
+				return m_immortal;
+			}
+
 			virtual Node* Clone()
 			{
 				return new Node(*this);
 			}
 
+			/**
+			 * Call the visitor with each child of
+			 * this node, in source order.
+			 *
+			 * Children are passed by reference so
+			 * that passes over the AST are able to
+			 * replace them in place.
+			 */
+			virtual void VisitChildren(const std::function<void(Node*&)>&)
+			{
+			}
+
 		protected:
 			Node*             m_parent = nullptr;
 			
 			NodeType          m_type;
 
+			/**
+			 * Position of the node within the source,
+			 * zero if the node was not built from
+			 * a token.
+			 */
+			uint32_t          m_line   = 0;
+			uint32_t          m_column = 0;
+
 			/**
 			 * Used only for the Interpreter.
 			 *
@@ -72,6 +130,26 @@ namespace Shakara
 			 */
 			bool              m_markDelete = false;
 
+			/**
+			 * Used only for the Interpreter.
+			 *
+			 * Marks a node as being owned by a constant
+			 * pool, meaning that it may be shared between
+			 * any amount of scopes and arrays, and should
+			 * never be deleted by them.
+			 */
+			bool              m_immortal   = false;
+
 		};
+
+		/**
+		 * Delete a runtime value, unless it is
+		 * an immortal value from a constant pool.
+		 */
+		static inline void ReleaseNode(Node* node)
+		{
+			if (node && !node->Immortal())
+				delete node;
+		}
 	}
 }
\ No newline at end of file
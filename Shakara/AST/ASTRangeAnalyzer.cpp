@@ -0,0 +1,427 @@
+#include "../stdafx.hpp"
+#include "ASTRangeAnalyzer.hpp"
+
+#include "ASTTypes.hpp"
+#include "ASTNode.hpp"
+#include "Nodes/ASTIdentifierNode.hpp"
+#include "Nodes/ASTIntegerNode.hpp"
+#include "Nodes/ASTRootNode.hpp"
+#include "Nodes/ASTFunctionDeclarationNode.hpp"
+#include "Nodes/ASTStructDeclarationNode.hpp"
+#include "Nodes/ASTFunctionCallNode.hpp"
+#include "Nodes/ASTAssignmentNode.hpp"
+#include "Nodes/ASTBinaryOperation.hpp"
+#include "Nodes/ASTWhileStatementNode.hpp"
+#include "Nodes/ASTForStatementNode.hpp"
+#include "Nodes/ASTArrayElementIdentifier.hpp"
+#include "Nodes/ASTMemberIdentifier.hpp"
+
+using namespace Shakara;
+using namespace Shakara::AST;
+
+static bool IsIdentifier(Node* node, const std::string& identifier)
+{
+	return node->Type() == NodeType::IDENTIFIER &&
+		static_cast<IdentifierNode*>(node)->Value() == identifier;
+}
+
+/**
+ * Grab the name of the variable that would be
+ * changed by writing to the passed in node, or
+ * nullptr if it isn't a variable at all
+ */
+static const std::string* WrittenVariable(Node* node)
+{
+	// Members are stored within the instance,
+	// which is stored within a variable
+	while (node->Type() == NodeType::MEMBER_IDENTIFIER)
+		node = static_cast<MemberIdentifierNode*>(node)->Object();
+
+	if (node->Type() == NodeType::IDENTIFIER)
+		return &static_cast<IdentifierNode*>(node)->Value();
+	else if (node->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+		return &static_cast<ArrayElementIdentifierNode*>(node)->ArrayIdentifier();
+
+	return nullptr;
+}
+
+/**
+ * Whether an assignment adds an integer to
+ * the index, such as "i = i + 1"
+ */
+static bool IsCountingUp(AssignmentNode* assign, const std::string& index)
+{
+	if (
+		!IsIdentifier(assign->GetIdentifier(), index) ||
+		assign->GetAssignment()->Type() != NodeType::BINARY_OP
+	)
+		return false;
+
+	BinaryOperation* operation = static_cast<BinaryOperation*>(assign->GetAssignment());
+
+	if (operation->Operation() != NodeType::ADD)
+		return false;
+
+	Node* leftHand  = operation->GetLeftHand();
+	Node* rightHand = operation->GetRightHand();
+
+	if (IsIdentifier(rightHand, index))
+		std::swap(leftHand, rightHand);
+
+	return IsIdentifier(leftHand, index) &&
+		rightHand->Type() == NodeType::INTEGER &&
+		static_cast<IntegerNode*>(rightHand)->Value() >= 0;
+}
+
+size_t ASTRangeAnalyzer::Analyze(RootNode* root)
+{
+	m_proven = 0;
+
+	m_declarations.clear();
+
+	_CollectFunctions(root, false);
+
+	_AnalyzeNode(root);
+
+	return m_proven;
+}
+
+void ASTRangeAnalyzer::_CollectFunctions(Node* node, bool function)
+{
+	if (node->Type() == NodeType::FUNCTION)
+	{
+		FunctionDeclaration* declaration = static_cast<FunctionDeclaration*>(node);
+
+		if (!function)
+			m_declarations[static_cast<IdentifierNode*>(declaration->Identifier())->Value()] = declaration;
+
+		_CollectFunctions(declaration->Body(), true);
+
+		return;
+	}
+
+	node->VisitChildren([this, function](Node*& child) {
+		_CollectFunctions(child, function);
+	});
+}
+
+void ASTRangeAnalyzer::_AnalyzeNode(Node* node)
+{
+	// The index of a loop is set by the statement
+	// right before it, so look at loops through
+	// the body holding them
+	if (node->Type() == NodeType::ROOT)
+	{
+		RootNode* body = static_cast<RootNode*>(node);
+
+		for (size_t index = 0; index < body->Children(); index++)
+		{
+			Node* child = (*body)[index];
+
+			if (child->Type() == NodeType::WHILE_STATEMENT && index > 0)
+				_AnalyzeLoop(static_cast<WhileStatement*>(child), (*body)[index - 1]);
+
+			_AnalyzeNode(child);
+		}
+
+		return;
+	}
+
+	if (node->Type() == NodeType::FOR_STATEMENT)
+		_AnalyzeRange(static_cast<ForStatement*>(node));
+
+	node->VisitChildren([this](Node*& child) {
+		_AnalyzeNode(child);
+	});
+}
+
+void ASTRangeAnalyzer::_AnalyzeLoop(
+	WhileStatement* loop,
+	Node*           previous
+)
+{
+	if (
+		previous->Type() != NodeType::ASSIGN ||
+		loop->Body()->Type() != NodeType::ROOT
+	)
+		return;
+
+	AssignmentNode* start = static_cast<AssignmentNode*>(previous);
+
+	// Integer literals are never negative, but an index
+	// could be made negative by anything else
+	if (
+		start->GetIdentifier()->Type() != NodeType::IDENTIFIER ||
+		start->GetAssignment()->Type() != NodeType::INTEGER    ||
+		static_cast<IntegerNode*>(start->GetAssignment())->Value() < 0
+	)
+		return;
+
+	const std::string& index = static_cast<IdentifierNode*>(start->GetIdentifier())->Value();
+
+	std::vector<std::pair<std::string, std::string>> bounds;
+
+	_FindBounds(loop->Condition(), bounds);
+
+	RootNode* body = static_cast<RootNode*>(loop->Body());
+
+	for (const auto& bound : bounds)
+	{
+		if (bound.first != index || !_CountsUp(loop, index, bound.second))
+			continue;
+
+		// Every statement up to the first counting the index
+		// up runs with the index the condition was true for
+		for (size_t statement = 0; statement < body->Children(); statement++)
+		{
+			if (_WritesIndex((*body)[statement], index))
+				break;
+
+			_MarkAccesses((*body)[statement], index, bound.second);
+		}
+	}
+}
+
+void ASTRangeAnalyzer::_AnalyzeRange(ForStatement* loop)
+{
+	if (!loop->IsRange() || loop->Body()->Type() != NodeType::ROOT)
+		return;
+
+	Node* start = loop->Start();
+	Node* end   = loop->End();
+
+	if (
+		start->Type() != NodeType::INTEGER            ||
+		static_cast<IntegerNode*>(start)->Value() < 0 ||
+		end->Type() != NodeType::CALL
+	)
+		return;
+
+	FunctionCall* call = static_cast<FunctionCall*>(end);
+
+	if (
+		call->Flags() != CallFlags::AMOUNT ||
+		call->Arguments().size() != 1      ||
+		call->Arguments()[0]->Type() != NodeType::IDENTIFIER
+	)
+		return;
+
+	const std::string& index = static_cast<IdentifierNode*>(loop->Identifier())->Value();
+	const std::string& array = static_cast<IdentifierNode*>(call->Arguments()[0])->Value();
+
+	// The variable of the loop is never assigned to
+	// within it, so the only thing left to prove is
+	// that the size of the array can't change
+	if (index == array || !_CountsUp(loop->Body(), index, array))
+		return;
+
+	_MarkAccesses(loop->Body(), index, array);
+}
+
+void ASTRangeAnalyzer::_FindBounds(
+	Node*                                             condition,
+	std::vector<std::pair<std::string, std::string>>& bounds
+)
+{
+	if (condition->Type() != NodeType::LOGICAL_OP)
+		return;
+
+	BinaryOperation* operation = static_cast<BinaryOperation*>(condition);
+
+	// Both sides of an and hold if it is true
+	if (operation->Operation() == NodeType::AND)
+	{
+		_FindBounds(operation->GetLeftHand(), bounds);
+		_FindBounds(operation->GetRightHand(), bounds);
+
+		return;
+	}
+
+	Node* index  = nullptr;
+	Node* amount = nullptr;
+
+	// Either "i < amt(values)" or "amt(values) > i"
+	if (operation->Operation() == NodeType::LESS_COMPARISON)
+	{
+		index  = operation->GetLeftHand();
+		amount = operation->GetRightHand();
+	}
+	else if (operation->Operation() == NodeType::GREATER_COMPARISON)
+	{
+		index  = operation->GetRightHand();
+		amount = operation->GetLeftHand();
+	}
+	else
+		return;
+
+	if (index->Type() != NodeType::IDENTIFIER || amount->Type() != NodeType::CALL)
+		return;
+
+	FunctionCall* call = static_cast<FunctionCall*>(amount);
+
+	if (
+		call->Flags() != CallFlags::AMOUNT ||
+		call->Arguments().size() != 1      ||
+		call->Arguments()[0]->Type() != NodeType::IDENTIFIER
+	)
+		return;
+
+	bounds.emplace_back(
+		static_cast<IdentifierNode*>(index)->Value(),
+		static_cast<IdentifierNode*>(call->Arguments()[0])->Value()
+	);
+}
+
+bool ASTRangeAnalyzer::_CountsUp(
+	Node*              node,
+	const std::string& index,
+	const std::string& array
+)
+{
+	// Declaring a function or struct only assigns it
+	// to its name, the body isn't ran until called
+	if (node->Type() == NodeType::FUNCTION)
+	{
+		const std::string& identifier = static_cast<IdentifierNode*>(static_cast<FunctionDeclaration*>(node)->Identifier())->Value();
+
+		return identifier != index && identifier != array;
+	}
+	else if (node->Type() == NodeType::STRUCT_DECLARATION)
+	{
+		const std::string& identifier = static_cast<IdentifierNode*>(static_cast<StructDeclaration*>(node)->Identifier())->Value();
+
+		return identifier != index && identifier != array;
+	}
+	// Another loop by either name would hide it
+	else if (node->Type() == NodeType::FOR_STATEMENT)
+	{
+		const std::string& identifier = static_cast<IdentifierNode*>(static_cast<ForStatement*>(node)->Identifier())->Value();
+
+		if (identifier == index || identifier == array)
+			return false;
+	}
+	else if (node->Type() == NodeType::ASSIGN)
+	{
+		AssignmentNode*    assign   = static_cast<AssignmentNode*>(node);
+		const std::string* variable = WrittenVariable(assign->GetIdentifier());
+
+		if (!variable)
+			return false;
+
+		// Assigning to an element of the array keeps its
+		// size, while assigning the whole array may not
+		if (*variable == array && assign->GetIdentifier()->Type() != NodeType::ARRAY_ELEMENT_IDENTIFIER)
+			return false;
+
+		if (*variable == index && !IsCountingUp(assign, index))
+			return false;
+	}
+	else if (node->Type() == NodeType::CALL)
+	{
+		FunctionCall* call = static_cast<FunctionCall*>(node);
+
+		if (
+			call->Flags() == CallFlags::PUSH_COLLECTION ||
+			call->Flags() == CallFlags::POP_COLLECTION
+		)
+		{
+			if (call->Arguments().empty())
+				return false;
+
+			const std::string* variable = WrittenVariable(call->Arguments()[0]);
+
+			if (variable && (*variable == array || *variable == index))
+				return false;
+		}
+		else if (call->Flags() == CallFlags::NONE)
+		{
+			// Only pure functions are known not to change
+			// either, and a function is only marked pure if
+			// it is the one definition of its name
+			if (call->Identifier()->Type() != NodeType::IDENTIFIER)
+				return false;
+
+			auto find = m_declarations.find(static_cast<IdentifierNode*>(call->Identifier())->Value());
+
+			if (find == m_declarations.end() || !find->second->Pure())
+				return false;
+		}
+	}
+
+	bool counts = true;
+
+	node->VisitChildren([this, &index, &array, &counts](Node*& child) {
+		if (counts)
+			counts = _CountsUp(child, index, array);
+	});
+
+	return counts;
+}
+
+bool ASTRangeAnalyzer::_WritesIndex(
+	Node*              node,
+	const std::string& index
+)
+{
+	if (
+		node->Type() == NodeType::FUNCTION ||
+		node->Type() == NodeType::STRUCT_DECLARATION
+	)
+		return false;
+
+	if (node->Type() == NodeType::ASSIGN)
+	{
+		const std::string* variable = WrittenVariable(static_cast<AssignmentNode*>(node)->GetIdentifier());
+
+		if (variable && *variable == index)
+			return true;
+	}
+	else if (
+		node->Type() == NodeType::FOR_STATEMENT &&
+		static_cast<IdentifierNode*>(static_cast<ForStatement*>(node)->Identifier())->Value() == index
+	)
+		return true;
+
+	bool writes = false;
+
+	node->VisitChildren([this, &index, &writes](Node*& child) {
+		if (!writes)
+			writes = _WritesIndex(child, index);
+	});
+
+	return writes;
+}
+
+void ASTRangeAnalyzer::_MarkAccesses(
+	Node*              node,
+	const std::string& index,
+	const std::string& array
+)
+{
+	if (
+		node->Type() == NodeType::FUNCTION ||
+		node->Type() == NodeType::STRUCT_DECLARATION
+	)
+		return;
+
+	if (node->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+	{
+		ArrayElementIdentifierNode* element = static_cast<ArrayElementIdentifierNode*>(node);
+
+		if (
+			element->ArrayIdentifier() == array &&
+			!element->Column()                  &&
+			!element->InBounds()                &&
+			IsIdentifier(element->Index(), index)
+		)
+		{
+			element->InBounds(true);
+
+			m_proven++;
+		}
+	}
+
+	node->VisitChildren([this, &index, &array](Node*& child) {
+		_MarkAccesses(child, index, array);
+	});
+}
\ No newline at end of file
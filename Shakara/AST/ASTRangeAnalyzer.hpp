@@ -0,0 +1,124 @@
+#pragma once
+
+namespace Shakara
+{
+	namespace AST
+	{
+		class Node;
+
+		class RootNode;
+
+		class WhileStatement;
+
+		class ForStatement;
+
+		class AssignmentNode;
+
+		class FunctionDeclaration;
+
+		/**
+		 * Proves array accesses within counted loops are
+		 * within the bounds of the array, within a checked
+		 * AST, so the interpreter can skip checking them.
+		 *
+		 * A counted loop sets its index to an integer right
+		 * before it, runs while the index is less than the
+		 * amount of an array, and only ever counts the index
+		 * up. Indexing the array with the index before the
+		 * index is counted up within an iteration is then
+		 * always within bounds, as long as nothing within
+		 * the loop can change the size of the array.
+		 *
+		 * A for loop over a range starting at an integer
+		 * and ending at the amount of an array is counted
+		 * the same way, with its variable as the index.
+		 */
+		class ASTRangeAnalyzer
+		{
+		public:
+			/**
+			 * Prove each access under the passed in root
+			 * that can be, returning how many were.
+			 */
+			size_t Analyze(RootNode* root);
+
+		private:
+			/**
+			 * Functions declared outside of a function body,
+			 * mapped by their identifier.
+			 */
+			std::map<std::string, FunctionDeclaration*> m_declarations;
+
+			/**
+			 * Amount of accesses proven in the current pass
+			 */
+			size_t                                      m_proven = 0;
+
+			/**
+			 * Walk a node and its children, recording every
+			 * function declared outside of a function.
+			 */
+			void _CollectFunctions(Node* node, bool function);
+
+			/**
+			 * Walk a node and its children, analyzing each
+			 * loop found along with the statement before it.
+			 */
+			void _AnalyzeNode(Node* node);
+
+			/**
+			 * Prove the accesses of a loop for each index
+			 * its condition bounds by the amount of an array.
+			 */
+			void _AnalyzeLoop(
+				WhileStatement* loop,
+				Node*           previous
+			);
+
+			/**
+			 * Prove the accesses of a for loop whose range
+			 * ends at the amount of an array.
+			 */
+			void _AnalyzeRange(ForStatement* loop);
+
+			/**
+			 * Find each comparison of an index against the
+			 * amount of an array that must hold for the
+			 * condition to be true.
+			 */
+			void _FindBounds(
+				Node*                                             condition,
+				std::vector<std::pair<std::string, std::string>>& bounds
+			);
+
+			/**
+			 * Whether a node only ever counts the index up,
+			 * and can't change the size of the array.
+			 */
+			bool _CountsUp(
+				Node*              node,
+				const std::string& index,
+				const std::string& array
+			);
+
+			/**
+			 * Whether a node writes to the index anywhere.
+			 */
+			bool _WritesIndex(
+				Node*              node,
+				const std::string& index
+			);
+
+			/**
+			 * Mark every access of the array by the index
+			 * within a node as being within bounds.
+			 */
+			void _MarkAccesses(
+				Node*              node,
+				const std::string& index,
+				const std::string& array
+			);
+
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,316 @@
+#include "../stdafx.hpp"
+#include "ASTTypeInferrer.hpp"
+
+#include "ASTTypes.hpp"
+#include "ASTNode.hpp"
+#include "Nodes/ASTIdentifierNode.hpp"
+#include "Nodes/ASTRootNode.hpp"
+#include "Nodes/ASTFunctionDeclarationNode.hpp"
+#include "Nodes/ASTStructDeclarationNode.hpp"
+#include "Nodes/ASTFunctionCallNode.hpp"
+#include "Nodes/ASTAssignmentNode.hpp"
+#include "Nodes/ASTBinaryOperation.hpp"
+#include "Nodes/ASTArrayElementIdentifier.hpp"
+#include "Nodes/ASTMemberIdentifier.hpp"
+#include "Nodes/ASTForStatementNode.hpp"
+
+using namespace Shakara;
+using namespace Shakara::AST;
+
+/**
+ * Grab the name of the variable that would be
+ * changed by writing to the passed in node, or
+ * nullptr if it isn't a variable at all
+ */
+static const std::string* WrittenVariable(Node* node)
+{
+	// Members are stored within the instance,
+	// which is stored within a variable
+	while (node->Type() == NodeType::MEMBER_IDENTIFIER)
+		node = static_cast<MemberIdentifierNode*>(node)->Object();
+
+	if (node->Type() == NodeType::IDENTIFIER)
+		return &static_cast<IdentifierNode*>(node)->Value();
+	else if (node->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+		return &static_cast<ArrayElementIdentifierNode*>(node)->ArrayIdentifier();
+
+	return nullptr;
+}
+
+static bool IsArithmetic(const NodeType& operation)
+{
+	return operation == NodeType::ADD      ||
+		operation == NodeType::SUBTRACT ||
+		operation == NodeType::MULTIPLY ||
+		operation == NodeType::DIVIDE   ||
+		operation == NodeType::MODULUS;
+}
+
+size_t ASTTypeInferrer::Infer(RootNode* root)
+{
+	m_proven = 0;
+
+	m_assignments.clear();
+	m_excluded.clear();
+	m_types.clear();
+
+	m_excluded[SHAKARA_CMD_ARGS_NAME]++;
+
+	_CollectAssignments(root);
+
+	for (const auto& assignments : m_assignments)
+		if (m_excluded.find(assignments.first) == m_excluded.end())
+			m_types[assignments.first] = Inferred::UNASSIGNED;
+
+	// A variable assigned from another variable is only
+	// known once that one is, so keep going until nothing
+	// changes, which it can't forever, as a variable only
+	// ever goes from unassigned, to a type, to unknown
+	bool changed = true;
+
+	while (changed)
+	{
+		changed = false;
+
+		for (auto& type : m_types)
+		{
+			Inferred inferred = type.second;
+
+			for (Node* value : m_assignments[type.first])
+			{
+				Inferred assigned = _ExpressionType(value);
+
+				if (inferred == Inferred::UNASSIGNED)
+					inferred = assigned;
+				else if (assigned != Inferred::UNASSIGNED && assigned != inferred)
+					inferred = Inferred::UNKNOWN;
+			}
+
+			if (inferred != type.second)
+			{
+				type.second = inferred;
+
+				changed = true;
+			}
+		}
+	}
+
+	_MarkNode(root);
+
+	return m_proven;
+}
+
+bool ASTTypeInferrer::ProvenType(Node* node, NodeType& type)
+{
+	if (node->Type() == NodeType::INTEGER || node->Type() == NodeType::DECIMAL)
+	{
+		type = node->Type();
+
+		return true;
+	}
+	else if (node->Type() == NodeType::IDENTIFIER && static_cast<IdentifierNode*>(node)->Proven())
+	{
+		type = static_cast<IdentifierNode*>(node)->ProvenType();
+
+		return true;
+	}
+	else if (node->Type() == NodeType::BINARY_OP && static_cast<BinaryOperation*>(node)->Proven())
+	{
+		type = static_cast<BinaryOperation*>(node)->ProvenType();
+
+		return true;
+	}
+
+	return false;
+}
+
+void ASTTypeInferrer::_CollectAssignments(Node* node)
+{
+	if (node->Type() == NodeType::FUNCTION)
+	{
+		FunctionDeclaration* declaration = static_cast<FunctionDeclaration*>(node);
+
+		m_excluded[static_cast<IdentifierNode*>(declaration->Identifier())->Value()]++;
+
+		for (size_t index = 0; index < declaration->Arguments().size(); index++)
+		{
+			Node* argument = declaration->Arguments()[index];
+
+			if (argument->Type() == NodeType::IDENTIFIER)
+				m_excluded[static_cast<IdentifierNode*>(argument)->Value()]++;
+		}
+	}
+	else if (node->Type() == NodeType::STRUCT_DECLARATION)
+	{
+		StructDeclaration* declaration = static_cast<StructDeclaration*>(node);
+
+		m_excluded[static_cast<IdentifierNode*>(declaration->Identifier())->Value()]++;
+
+		// Fields are read by name within member functions,
+		// and can be given any value when creating an instance
+		for (size_t index = 0; index < declaration->Fields(); index++)
+			m_excluded[declaration->FieldName(index)]++;
+	}
+	else if (node->Type() == NodeType::ASSIGN)
+	{
+		AssignmentNode* assign = static_cast<AssignmentNode*>(node);
+
+		if (assign->GetIdentifier()->Type() == NodeType::IDENTIFIER)
+			m_assignments[static_cast<IdentifierNode*>(assign->GetIdentifier())->Value()].push_back(assign->GetAssignment());
+		else
+		{
+			const std::string* variable = WrittenVariable(assign->GetIdentifier());
+
+			if (variable)
+				m_excluded[*variable]++;
+		}
+	}
+	else if (node->Type() == NodeType::FOR_STATEMENT)
+	{
+		ForStatement*      statement  = static_cast<ForStatement*>(node);
+		const std::string& identifier = static_cast<IdentifierNode*>(statement->Identifier())->Value();
+
+		// Ranges count up by integers from their start,
+		// while elements of an array can be anything
+		if (statement->IsRange())
+			m_assignments[identifier].push_back(statement->Start());
+		else
+			m_excluded[identifier]++;
+	}
+	else if (node->Type() == NodeType::CALL)
+	{
+		FunctionCall* call = static_cast<FunctionCall*>(node);
+
+		if (
+			(call->Flags() == CallFlags::PUSH_COLLECTION ||
+			 call->Flags() == CallFlags::POP_COLLECTION) &&
+			!call->Arguments().empty()
+		)
+		{
+			const std::string* variable = WrittenVariable(call->Arguments()[0]);
+
+			if (variable)
+				m_excluded[*variable]++;
+		}
+	}
+
+	node->VisitChildren([this](Node*& child) {
+		_CollectAssignments(child);
+	});
+}
+
+ASTTypeInferrer::Inferred ASTTypeInferrer::_ExpressionType(Node* node)
+{
+	if (node->Type() == NodeType::INTEGER)
+		return Inferred::INTEGER;
+	else if (node->Type() == NodeType::DECIMAL)
+		return Inferred::DECIMAL;
+	else if (node->Type() == NodeType::IDENTIFIER)
+	{
+		auto find = m_types.find(static_cast<IdentifierNode*>(node)->Value());
+
+		return (find != m_types.end()) ? find->second : Inferred::UNKNOWN;
+	}
+	else if (node->Type() == NodeType::BINARY_OP)
+	{
+		BinaryOperation* operation = static_cast<BinaryOperation*>(node);
+
+		if (!IsArithmetic(operation->Operation()))
+			return Inferred::UNKNOWN;
+
+		Inferred leftHand  = _ExpressionType(operation->GetLeftHand());
+		Inferred rightHand = _ExpressionType(operation->GetRightHand());
+
+		if (leftHand == Inferred::UNKNOWN || rightHand == Inferred::UNKNOWN)
+			return Inferred::UNKNOWN;
+		else if (leftHand == Inferred::UNASSIGNED || rightHand == Inferred::UNASSIGNED)
+			return Inferred::UNASSIGNED;
+
+		// Either side being a decimal makes the result one
+		return (leftHand == Inferred::INTEGER && rightHand == Inferred::INTEGER) ?
+			Inferred::INTEGER : Inferred::DECIMAL;
+	}
+	else if (node->Type() == NodeType::CALL)
+	{
+		// Built-ins that can only ever return an integer,
+		// or nothing at all if they report an error
+		switch (static_cast<FunctionCall*>(node)->Flags())
+		{
+		case CallFlags::AMOUNT:
+		case CallFlags::INTEGER_CAST:
+		case CallFlags::COUNT:
+		case CallFlags::INDEX_OF:
+		case CallFlags::BINARY_SEARCH:
+		case CallFlags::LOWER_BOUND:
+			return Inferred::INTEGER;
+		case CallFlags::DECIMAL_CAST:
+			return Inferred::DECIMAL;
+		default:
+			return Inferred::UNKNOWN;
+		}
+	}
+
+	return Inferred::UNKNOWN;
+}
+
+void ASTTypeInferrer::_MarkNode(Node* node)
+{
+	node->VisitChildren([this](Node*& child) {
+		_MarkNode(child);
+	});
+
+	if (node->Type() == NodeType::IDENTIFIER)
+	{
+		IdentifierNode* identifier = static_cast<IdentifierNode*>(node);
+
+		auto find = m_types.find(identifier->Value());
+
+		if (find == m_types.end())
+			return;
+
+		if (find->second == Inferred::INTEGER)
+			identifier->ProvenType(NodeType::INTEGER);
+		else if (find->second == Inferred::DECIMAL)
+			identifier->ProvenType(NodeType::DECIMAL);
+	}
+	else if (node->Type() == NodeType::BINARY_OP)
+	{
+		BinaryOperation* operation = static_cast<BinaryOperation*>(node);
+
+		NodeType leftHand  = NodeType::ROOT;
+		NodeType rightHand = NodeType::ROOT;
+
+		if (
+			!ProvenType(operation->GetLeftHand(), leftHand)   ||
+			!ProvenType(operation->GetRightHand(), rightHand) ||
+			leftHand == NodeType::BOOLEAN                     ||
+			rightHand == NodeType::BOOLEAN
+		)
+			return;
+
+		if (IsArithmetic(operation->Operation()))
+			operation->ProvenType(
+				(leftHand == NodeType::INTEGER && rightHand == NodeType::INTEGER) ?
+				NodeType::INTEGER : NodeType::DECIMAL
+			);
+		// Comparing an integer with a decimal is an error,
+		// so only comparisons of the same type are proven
+		else if (
+			IsLogicalOperation(operation->Operation()) &&
+			operation->Operation() != NodeType::AND    &&
+			operation->Operation() != NodeType::OR     &&
+			leftHand == rightHand
+		)
+			operation->ProvenType(NodeType::BOOLEAN);
+		else
+			return;
+
+		m_proven++;
+	}
+	else if (node->Type() == NodeType::CALL && static_cast<FunctionCall*>(node)->Inlined())
+	{
+		// Inlined expressions read the variables of the
+		// caller, so they are marked the same way
+		_MarkNode(static_cast<FunctionCall*>(node)->Inlined());
+	}
+}
\ No newline at end of file
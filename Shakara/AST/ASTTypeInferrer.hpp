@@ -0,0 +1,96 @@
+#pragma once
+
+namespace Shakara
+{
+	namespace AST
+	{
+		class Node;
+
+		class RootNode;
+
+		enum class NodeType : uint8_t;
+
+		/**
+		 * Infers which variables only ever hold integers,
+		 * or only ever hold decimals, within a checked AST,
+		 * and marks the operations made only of them.
+		 *
+		 * Variables are inferred by name across the whole
+		 * AST, as a function reads the variables of whatever
+		 * called it. Any variable that can be given a value
+		 * other than by assignment, such as an argument or a
+		 * field, is never inferred.
+		 *
+		 * The interpreter evaluates marked operations without
+		 * checking the types of either side.
+		 */
+		class ASTTypeInferrer
+		{
+		public:
+			/**
+			 * Mark each operation under the passed in root
+			 * that can be, returning how many were.
+			 */
+			size_t Infer(RootNode* root);
+
+			/**
+			 * Grab the type a node is proven to evaluate
+			 * to, either from being a literal or from being
+			 * marked, returning false if it isn't proven.
+			 */
+			static bool ProvenType(Node* node, NodeType& type);
+
+		private:
+			/**
+			 * What is known about the type of a variable,
+			 * starting from nothing assigned, and becoming
+			 * unknown once assigned two different types.
+			 */
+			enum class Inferred : uint8_t
+			{
+				UNASSIGNED = 0x00,
+				INTEGER    = 0x01,
+				DECIMAL    = 0x02,
+				UNKNOWN    = 0x03
+			};
+
+			/**
+			 * Every value assigned to each variable that
+			 * is only ever given a value by assignment.
+			 */
+			std::map<std::string, std::vector<Node*>> m_assignments;
+
+			/**
+			 * Variables given a value some other way.
+			 */
+			std::map<std::string, size_t>             m_excluded;
+
+			std::map<std::string, Inferred>           m_types;
+
+			/**
+			 * Amount of operations marked in the current pass
+			 */
+			size_t                                    m_proven = 0;
+
+			/**
+			 * Walk a node and its children, recording every
+			 * assignment to a variable, and every variable
+			 * given a value some other way.
+			 */
+			void _CollectAssignments(Node* node);
+
+			/**
+			 * Infer the type of an expression assigned to a
+			 * variable from what is known so far.
+			 */
+			Inferred _ExpressionType(Node* node);
+
+			/**
+			 * Walk a node and its children, marking each
+			 * variable and operation with its proven type.
+			 */
+			void _MarkNode(Node* node);
+
+		};
+	}
+}
\ No newline at end of file
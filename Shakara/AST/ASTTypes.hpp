@@ -12,9 +12,11 @@ namespace Shakara
 			BINARY_OP                = 0x02,
 			LOGICAL_OP               = 0x03,
 			FUNCTION                 = 0x04,
+			STRUCT_DECLARATION       = 0x1E,
 			CALL                     = 0x05,
 			IF_STATEMENT             = 0x06,
 			WHILE_STATEMENT          = 0x07,
+			FOR_STATEMENT            = 0x22,
 
 			/**
 			 * Type Nodes
@@ -23,9 +25,13 @@ namespace Shakara
 			DECIMAL                  = 0x09,
 			IDENTIFIER               = 0x0A,
 			ARRAY_ELEMENT_IDENTIFIER = 0x0B,
+			MEMBER_IDENTIFIER        = 0x20,
 			STRING                   = 0x0C,
 			BOOLEAN                  = 0x0D,
 			ARRAY                    = 0x0E,
+			MAP                      = 0x1D,
+			STRUCT                   = 0x1F,
+			MATRIX                   = 0x21,
 
 			/**
 			 * Arithmetic Types for
@@ -52,7 +58,9 @@ namespace Shakara
 			/**
 			 * Special Node Types (return, etc)
 			 */
-			RETURN                   = 0x1C
+			RETURN                   = 0x1C,
+			BREAK                    = 0x23,
+			CONTINUE                 = 0x24
 		};
 
 		static inline bool IsLogicalOperation(const NodeType& type)
@@ -103,8 +111,22 @@ namespace Shakara
 				return "modulus";
 			case NodeType::RETURN:
 				return "return";
+			case NodeType::BREAK:
+				return "break";
+			case NodeType::CONTINUE:
+				return "continue";
 			case NodeType::ARRAY:
 				return "array";
+			case NodeType::MAP:
+				return "map";
+			case NodeType::STRUCT_DECLARATION:
+				return "struct declaration";
+			case NodeType::STRUCT:
+				return "struct";
+			case NodeType::MEMBER_IDENTIFIER:
+				return "member identifier";
+			case NodeType::MATRIX:
+				return "matrix";
 			}
 
 			return "Unknown";
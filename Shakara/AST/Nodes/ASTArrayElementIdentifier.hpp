@@ -16,11 +16,15 @@ namespace Shakara
 				m_type            = identifier.Type();
 				m_arrayIdentifier = identifier.ArrayIdentifier();
 				m_index           = identifier.Index()->Clone();
+
+				if (identifier.Column())
+					m_column = identifier.Column()->Clone();
 			}
 
 			~ArrayElementIdentifierNode()
 			{
 				delete m_index;
+				delete m_column;
 			}
 
 			inline ArrayElementIdentifierNode& ArrayIdentifier(const std::string& identifier)
@@ -49,16 +53,66 @@ namespace Shakara
 				return m_index;
 			}
 
+			/**
+			 * A second index, after the first, which
+			 * picks the column of a matrix element.
+			 */
+			inline ArrayElementIdentifierNode& Column(Node* column)
+			{
+				column->Parent(this);
+
+				m_column = column;
+
+				return *this;
+			}
+
+			inline Node* Column() const
+			{
+				return m_column;
+			}
+
+			/**
+			 * Set by range analysis for accesses whose index
+			 * is a variable proven to be an integer within the
+			 * bounds of the array whenever it is accessed.
+			 *
+			 * Only holds while the variable is an array, as
+			 * maps and strings are accessed by other rules.
+			 */
+			inline ArrayElementIdentifierNode& InBounds(bool inBounds)
+			{
+				m_inBounds = inBounds;
+
+				return *this;
+			}
+
+			inline bool InBounds() const
+			{
+				return m_inBounds;
+			}
+
 			Node* Clone()
 			{
 				return new ArrayElementIdentifierNode(*this);
 			}
 
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_index);
+
+				if (m_column)
+					visitor(m_column);
+			}
+
 		private:
 			std::string m_arrayIdentifier = "";
 
 			Node*       m_index           = nullptr;
 
+			Node*       m_column          = nullptr;
+
+			bool        m_inBounds        = false;
+
 		};
 	}
 }
\ No newline at end of file
@@ -1,52 +1,258 @@
 #pragma once
 
 #include "../ASTNode.hpp"
+#include "../ASTTypes.hpp"
+#include "ASTIntegerNode.hpp"
+#include "ASTDecimalNode.hpp"
+#include "ASTBooleanNode.hpp"
 
 namespace Shakara
 {
 	namespace AST
 	{
+		/**
+		 * How the elements of an array are stored.
+		 *
+		 * Boxed arrays store a node for each element,
+		 * while the others store the values of a
+		 * single type packed together.
+		 */
+		enum class ArrayStorage : uint8_t
+		{
+			BOXED   = 0x00,
+			INTEGER = 0x01,
+			DECIMAL = 0x02,
+			BOOLEAN = 0x03
+		};
+
 		/**
 		 * A node to be used as a dynamic or static array
 		 * type.
+		 *
+		 * Copies of an array share its elements, and the
+		 * elements are only copied once an array sharing
+		 * them is changed.
+		 *
+		 * Elements before the head of the storage in use
+		 * have been popped off the front, which lets the
+		 * array be used as a queue without shifting every
+		 * element down on each pop.
 		 */
 		class ArrayNode : public Node
 		{
 		public:
+			ArrayNode() = default;
+
+			ArrayNode(const ArrayNode& rhs)
+			{
+				m_buffer   = rhs.m_buffer;
+				m_fixed    = rhs.m_fixed;
+				m_packable = rhs.m_packable;
+				m_limit    = rhs.m_limit;
+				m_type     = rhs.Type();
+				m_parent   = rhs.Parent();
+
+				if (rhs.m_capacity)
+					m_capacity = (rhs.m_capacity->Immortal()) ? rhs.m_capacity : rhs.m_capacity->Clone();
+			}
+
 			~ArrayNode()
 			{
-				delete m_capacity;
+				// Elements of evaluated arrays can be
+				// shared constants, so release rather
+				// than delete them, which the buffer
+				// does once no array shares it
+				ReleaseNode(m_capacity);
+			}
+
+			/**
+			 * Allow the array to pack its elements while
+			 * they are all integers, decimals, or booleans.
+			 *
+			 * Only used by the interpreter, as the elements
+			 * of an array within the AST are expressions.
+			 */
+			inline ArrayNode& Packable(bool state)
+			{
+				m_packable = state;
+
+				return *this;
+			}
 
-				for (size_t index = 0; index < m_elements.size(); index++)
-					delete m_elements[index];
+			inline bool Packable() const
+			{
+				return m_packable;
+			}
 
-				m_elements.clear();
+			inline ArrayStorage Storage() const
+			{
+				return m_buffer->storage;
 			}
 
 			inline ArrayNode& Insert(Node* node)
 			{
+				Unshare();
+
+				// A packed value is copied out of the
+				// node, so the node is no longer needed
+				if (_Pack(node, Size()))
+				{
+					ReleaseNode(node);
+
+					return *this;
+				}
+
+				_Box();
+
 				node->Parent(this);
 
-				m_elements.push_back(node);
+				m_buffer->elements.push_back(node);
+
+				return *this;
+			}
+
+			/**
+			 * Make room for an amount of elements up
+			 * front, for when the size of the array is
+			 * known before inserting.
+			 */
+			inline ArrayNode& Reserve(size_t amount)
+			{
+				Unshare();
+
+				Buffer& buffer = *m_buffer;
+
+				switch (buffer.storage)
+				{
+				case ArrayStorage::INTEGER:
+					buffer.integers.reserve(buffer.head + amount);
+					break;
+				case ArrayStorage::DECIMAL:
+					buffer.decimals.reserve(buffer.head + amount);
+					break;
+				case ArrayStorage::BOOLEAN:
+					buffer.booleans.reserve(buffer.head + amount);
+					break;
+				default:
+					buffer.elements.reserve(buffer.head + amount);
+					break;
+				}
 
 				return *this;
 			}
 
+			/**
+			 * Remove an element, which takes amortized
+			 * constant time from either end.
+			 */
 			inline ArrayNode& Pop(size_t index)
 			{
-				m_elements.erase(m_elements.begin() + index);
+				Unshare();
+
+				Buffer& buffer = *m_buffer;
+
+				switch (buffer.storage)
+				{
+				case ArrayStorage::INTEGER:
+					_Remove(buffer.integers, index);
+					break;
+				case ArrayStorage::DECIMAL:
+					_Remove(buffer.decimals, index);
+					break;
+				case ArrayStorage::BOOLEAN:
+					_Remove(buffer.booleans, index);
+					break;
+				default:
+					ReleaseNode(buffer.elements[buffer.head + index]);
+
+					buffer.elements[buffer.head + index] = nullptr;
+
+					_Remove(buffer.elements, index);
+					break;
+				}
 
 				return *this;
 			}
 
 			inline ArrayNode& Set(size_t index, Node* node)
 			{
+				Unshare();
+
+				if (_Pack(node, index))
+				{
+					ReleaseNode(node);
+
+					return *this;
+				}
+
+				_Box();
+
 				node->Parent(this);
 
-				if (m_elements[index])
-					delete m_elements[index];
+				Buffer& buffer = *m_buffer;
+
+				ReleaseNode(buffer.elements[buffer.head + index]);
 
-				m_elements[index] = node;
+				buffer.elements[buffer.head + index] = node;
+
+				return *this;
+			}
+
+			/**
+			 * Copy the elements if they are shared with
+			 * another array, so that changing them only
+			 * changes this array.
+			 *
+			 * Called by every method changing elements,
+			 * and by the interpreter before changing an
+			 * element in place.
+			 */
+			inline ArrayNode& Unshare()
+			{
+				if (m_buffer.use_count() == 1)
+					return *this;
+
+				const Buffer&           shared = *m_buffer;
+				std::shared_ptr<Buffer> buffer = std::make_shared<Buffer>();
+
+				buffer->storage = shared.storage;
+
+				size_t size = Size();
+
+				switch (shared.storage)
+				{
+				case ArrayStorage::INTEGER:
+					buffer->integers.reserve(std::max(size, m_limit));
+					buffer->integers.assign(shared.integers.begin() + shared.head, shared.integers.end());
+					break;
+				case ArrayStorage::DECIMAL:
+					buffer->decimals.reserve(std::max(size, m_limit));
+					buffer->decimals.assign(shared.decimals.begin() + shared.head, shared.decimals.end());
+					break;
+				case ArrayStorage::BOOLEAN:
+					buffer->booleans.reserve(std::max(size, m_limit));
+					buffer->booleans.assign(shared.booleans.begin() + shared.head, shared.booleans.end());
+					break;
+				default:
+					buffer->elements.reserve(std::max(size, m_limit));
+
+					for (size_t index = shared.head; index < shared.elements.size(); index++)
+					{
+						Node* element = shared.elements[index];
+
+						if (!element->Immortal())
+						{
+							element = element->Clone();
+							element->Parent(this);
+						}
+
+						buffer->elements.push_back(element);
+					}
+
+					break;
+				}
+
+				m_buffer = buffer;
 
 				return *this;
 			}
@@ -65,7 +271,19 @@ namespace Shakara
 
 			inline size_t Size() const
 			{
-				return m_elements.size();
+				const Buffer& buffer = *m_buffer;
+
+				switch (buffer.storage)
+				{
+				case ArrayStorage::INTEGER:
+					return buffer.integers.size() - buffer.head;
+				case ArrayStorage::DECIMAL:
+					return buffer.decimals.size() - buffer.head;
+				case ArrayStorage::BOOLEAN:
+					return buffer.booleans.size() - buffer.head;
+				default:
+					return buffer.elements.size() - buffer.head;
+				}
 			}
 
 			inline ArrayNode& Capacity(Node* value)
@@ -80,17 +298,339 @@ namespace Shakara
 				return m_capacity;
 			}
 
+			/**
+			 * The evaluated capacity of a fixed array,
+			 * which its storage is allocated for once
+			 * rather than being grown.
+			 */
+			inline ArrayNode& Limit(size_t limit)
+			{
+				m_limit = limit;
+
+				Reserve(limit);
+
+				return *this;
+			}
+
+			inline size_t Limit() const
+			{
+				return m_limit;
+			}
+
+			/**
+			 * Whether the array is fixed and can't
+			 * hold any more elements.
+			 */
+			inline bool Full() const
+			{
+				return m_fixed && Size() >= m_limit;
+			}
+
+			/**
+			 * Grab the type of a single element,
+			 * whether it is packed or not.
+			 */
+			inline NodeType ElementType(const size_t index) const
+			{
+				switch (m_buffer->storage)
+				{
+				case ArrayStorage::INTEGER:
+					return NodeType::INTEGER;
+				case ArrayStorage::DECIMAL:
+					return NodeType::DECIMAL;
+				case ArrayStorage::BOOLEAN:
+					return NodeType::BOOLEAN;
+				default:
+					return m_buffer->elements[m_buffer->head + index]->Type();
+				}
+			}
+
+			/**
+			 * Replace the elements of the array with
+			 * packed values, making the array packable.
+			 */
+			inline ArrayNode& Integers(std::vector<int32_t>&& values)
+			{
+				m_buffer = std::make_shared<Buffer>();
+
+				m_packable         = true;
+				m_buffer->storage  = ArrayStorage::INTEGER;
+				m_buffer->integers = std::move(values);
+
+				return *this;
+			}
+
+			inline ArrayNode& Decimals(std::vector<float>&& values)
+			{
+				m_buffer = std::make_shared<Buffer>();
+
+				m_packable         = true;
+				m_buffer->storage  = ArrayStorage::DECIMAL;
+				m_buffer->decimals = std::move(values);
+
+				return *this;
+			}
+
+			inline ArrayNode& Booleans(std::vector<uint8_t>&& values)
+			{
+				m_buffer = std::make_shared<Buffer>();
+
+				m_packable         = true;
+				m_buffer->storage  = ArrayStorage::BOOLEAN;
+				m_buffer->booleans = std::move(values);
+
+				return *this;
+			}
+
+			/**
+			 * The packed values of the array, which
+			 * are only filled for the storage in use,
+			 * holding Size() values each.
+			 */
+			inline const int32_t* Integers() const
+			{
+				return m_buffer->integers.data() + m_buffer->head;
+			}
+
+			inline const float* Decimals() const
+			{
+				return m_buffer->decimals.data() + m_buffer->head;
+			}
+
+			inline const uint8_t* Booleans() const
+			{
+				return m_buffer->booleans.data() + m_buffer->head;
+			}
+
+			/**
+			 * Grab the node of an element, which is
+			 * only stored for boxed arrays.
+			 */
 			inline Node* operator[](const size_t index) const
 			{
-				return m_elements[index];
+				return m_buffer->elements[m_buffer->head + index];
+			}
+
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				if (m_capacity)
+					visitor(m_capacity);
+
+				// Elements may be replaced by the visitor
+				Unshare();
+
+				Buffer& buffer = *m_buffer;
+
+				for (size_t index = buffer.head; index < buffer.elements.size(); index++)
+					visitor(buffer.elements[index]);
+			}
+
+			Node* Clone()
+			{
+				return new ArrayNode(*this);
 			}
 
 		private:
+			/**
+			 * The elements of an array, which may be
+			 * shared between copies of the array.
+			 */
+			struct Buffer
+			{
+				~Buffer()
+				{
+					for (size_t index = head; index < elements.size(); index++)
+						ReleaseNode(elements[index]);
+				}
+
+				ArrayStorage storage = ArrayStorage::BOXED;
+
+				/**
+				 * How many elements have been popped off
+				 * the front of the storage in use.
+				 */
+				size_t head = 0;
+
+				std::vector<Node*> elements;
+
+				std::vector<int32_t> integers;
+				std::vector<float>   decimals;
+				std::vector<uint8_t> booleans;
+			};
+
 			bool m_fixed = false;
 
+			bool m_packable = false;
+
 			Node* m_capacity = nullptr;
-			
-			std::vector<Node*> m_elements;
+
+			size_t m_limit = 0;
+
+			std::shared_ptr<Buffer> m_buffer = std::make_shared<Buffer>();
+
+			/**
+			 * Try to store the value of a node at an index
+			 * within the packed values, which can be one
+			 * past the end to insert.
+			 *
+			 * An empty array takes on the type of the first
+			 * node inserted into it.
+			 */
+			inline bool _Pack(Node* node, size_t index)
+			{
+				if (!m_packable)
+					return false;
+
+				ArrayStorage storage = ArrayStorage::BOXED;
+
+				if (node->Type() == NodeType::INTEGER)
+					storage = ArrayStorage::INTEGER;
+				else if (node->Type() == NodeType::DECIMAL)
+					storage = ArrayStorage::DECIMAL;
+				else if (node->Type() == NodeType::BOOLEAN)
+					storage = ArrayStorage::BOOLEAN;
+
+				if (storage == ArrayStorage::BOXED)
+					return false;
+
+				// Move any room reserved for nodes over to
+				// the values of the type being adopted
+				if (Size() == 0 && m_buffer->storage != storage)
+				{
+					size_t reserved = m_buffer->elements.capacity() - m_buffer->head;
+
+					m_buffer = std::make_shared<Buffer>();
+
+					m_buffer->storage = storage;
+
+					Reserve(reserved);
+				}
+
+				Buffer& buffer = *m_buffer;
+
+				if (buffer.storage != storage)
+					return false;
+
+				switch (buffer.storage)
+				{
+				case ArrayStorage::INTEGER:
+				{
+					int32_t value = static_cast<IntegerNode*>(node)->Value();
+
+					if (buffer.head + index == buffer.integers.size())
+						buffer.integers.push_back(value);
+					else
+						buffer.integers[buffer.head + index] = value;
+
+					break;
+				}
+				case ArrayStorage::DECIMAL:
+				{
+					float value = static_cast<DecimalNode*>(node)->Value();
+
+					if (buffer.head + index == buffer.decimals.size())
+						buffer.decimals.push_back(value);
+					else
+						buffer.decimals[buffer.head + index] = value;
+
+					break;
+				}
+				default:
+				{
+					uint8_t value = static_cast<uint8_t>(static_cast<BooleanNode*>(node)->Value());
+
+					if (buffer.head + index == buffer.booleans.size())
+						buffer.booleans.push_back(value);
+					else
+						buffer.booleans[buffer.head + index] = value;
+
+					break;
+				}
+				}
+
+				return true;
+			}
+
+			/**
+			 * Remove a value from the storage in use.
+			 *
+			 * Removing the first value only moves the head
+			 * forward, and the values before the head are
+			 * dropped once they take up half the storage,
+			 * so each removal is amortized constant time.
+			 */
+			template <typename T>
+			inline void _Remove(std::vector<T>& values, size_t index)
+			{
+				size_t& head = m_buffer->head;
+
+				if (index != 0)
+				{
+					values.erase(values.begin() + static_cast<std::ptrdiff_t>(head + index));
+
+					return;
+				}
+
+				head++;
+
+				if (head * 2 >= values.size())
+				{
+					values.erase(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(head));
+
+					head = 0;
+				}
+			}
+
+			/**
+			 * Move any packed values into a node for each
+			 * element, once the array holds mixed types.
+			 */
+			inline void _Box()
+			{
+				if (m_buffer->storage == ArrayStorage::BOXED)
+					return;
+
+				const Buffer&           packed = *m_buffer;
+				std::shared_ptr<Buffer> buffer = std::make_shared<Buffer>();
+
+				size_t size = Size();
+
+				buffer->elements.reserve(std::max(size + 1, m_limit));
+
+				for (size_t index = packed.head; index < packed.head + size; index++)
+				{
+					Node* element = nullptr;
+
+					if (packed.storage == ArrayStorage::INTEGER)
+					{
+						IntegerNode* integer = new IntegerNode();
+						integer->Value(false, packed.integers[index]);
+
+						element = integer;
+					}
+					else if (packed.storage == ArrayStorage::DECIMAL)
+					{
+						DecimalNode* decimal = new DecimalNode();
+						decimal->Value(false, packed.decimals[index]);
+
+						element = decimal;
+					}
+					else
+					{
+						BooleanNode* boolean = new BooleanNode();
+						boolean->Value(packed.booleans[index] != 0);
+
+						element = boolean;
+					}
+
+					element->Type(ElementType(0));
+					element->Parent(this);
+
+					buffer->elements.push_back(element);
+				}
+
+				m_buffer = buffer;
+			}
 
 		};
 	}
@@ -39,11 +39,37 @@ namespace Shakara
 				return m_assignment;
 			}
 
+			/**
+			 * Set whether this assigns an arithmetic operation
+			 * on the variable itself back to it, such as the
+			 * operations "a++", "a += b", and "a = a * b" are
+			 * built into, letting it be updated in place.
+			 */
+			inline AssignmentNode& SelfUpdate(bool state)
+			{
+				m_selfUpdate = state;
+
+				return *this;
+			}
+
+			inline bool SelfUpdate() const
+			{
+				return m_selfUpdate;
+			}
+
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_identifier);
+				visitor(m_assignment);
+			}
+
 		private:
 			Node* m_identifier = nullptr;
 
 			Node* m_assignment = nullptr;
 
+			bool  m_selfUpdate = false;
+
 		};
 	}
 }
\ No newline at end of file
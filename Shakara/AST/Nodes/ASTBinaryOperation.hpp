@@ -8,6 +8,8 @@ namespace Shakara
 	{
 		enum class NodeType : uint8_t;
 
+		class WhileStatement;
+
 		class BinaryOperation : public Node
 		{
 		public:
@@ -66,11 +68,63 @@ namespace Shakara
 				return m_rightHand;
 			}
 
+			/**
+			 * Set by the hoister for operations which never
+			 * change while a loop runs, to the loop and the
+			 * slot of the operation's value within it.
+			 */
+			inline BinaryOperation& Hoist(WhileStatement* loop, size_t slot)
+			{
+				m_hoistedLoop = loop;
+				m_hoistedSlot = slot;
+
+				return *this;
+			}
+
+			inline WhileStatement* HoistedLoop() const
+			{
+				return m_hoistedLoop;
+			}
+
+			inline size_t HoistedSlot() const
+			{
+				return m_hoistedSlot;
+			}
+
+			/**
+			 * Set by type inference for operations whose sides
+			 * are proven to always be integers or decimals, to
+			 * the type of the result.
+			 */
+			inline BinaryOperation& ProvenType(NodeType type)
+			{
+				m_provenType = type;
+				m_proven     = true;
+
+				return *this;
+			}
+
+			inline NodeType ProvenType() const
+			{
+				return m_provenType;
+			}
+
+			inline bool Proven() const
+			{
+				return m_proven;
+			}
+
 			Node* Clone()
 			{
 				return new BinaryOperation(*this);
 			}
 
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_leftHand);
+				visitor(m_rightHand);
+			}
+
 		private:
 			Node*    m_leftHand  = nullptr;
 
@@ -78,6 +132,12 @@ namespace Shakara
 
 			Node*    m_rightHand = nullptr;
 
+			WhileStatement* m_hoistedLoop = nullptr;
+			size_t          m_hoistedSlot = 0;
+
+			NodeType        m_provenType;
+			bool            m_proven      = false;
+
 		};
 	}
 }
\ No newline at end of file
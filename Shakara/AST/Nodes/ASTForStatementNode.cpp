@@ -0,0 +1,2 @@
+#include "../../stdafx.hpp"
+#include "ASTForStatementNode.hpp"
\ No newline at end of file
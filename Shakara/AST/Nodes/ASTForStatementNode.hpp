@@ -0,0 +1,130 @@
+#pragma once
+
+#include "../ASTNode.hpp"
+
+namespace Shakara
+{
+	namespace AST
+	{
+		/**
+		 * A loop running its body once for each integer
+		 * within a range, such as "for (i in 0..10)", or
+		 * for each element of an array, such as
+		 * "for (value in values)".
+		 *
+		 * Ranges go from the start up to, but not
+		 * including, the end, and have no iterable,
+		 * while going through an array has no end.
+		 */
+		class ForStatement : public Node
+		{
+		public:
+			~ForStatement()
+			{
+				delete m_identifier;
+
+				delete m_start;
+				delete m_end;
+
+				delete m_body;
+			}
+
+			inline ForStatement& Identifier(Node* node)
+			{
+				node->Parent(this);
+
+				m_identifier = node;
+
+				return *this;
+			}
+
+			inline ForStatement& Range(Node* start, Node* end)
+			{
+				start->Parent(this);
+				end->Parent(this);
+
+				m_start = start;
+				m_end   = end;
+
+				return *this;
+			}
+
+			inline ForStatement& Iterable(Node* node)
+			{
+				node->Parent(this);
+
+				m_start = node;
+
+				return *this;
+			}
+
+			inline ForStatement& Body(Node* node)
+			{
+				node->Parent(this);
+
+				m_body = node;
+
+				return *this;
+			}
+
+			/**
+			 * The variable given each integer of the
+			 * range, or each element of the array.
+			 */
+			inline Node* Identifier()
+			{
+				return m_identifier;
+			}
+
+			inline bool IsRange() const
+			{
+				return m_end != nullptr;
+			}
+
+			inline Node* Start()
+			{
+				return m_start;
+			}
+
+			inline Node* End()
+			{
+				return m_end;
+			}
+
+			inline Node* Iterable()
+			{
+				return m_start;
+			}
+
+			inline Node* Body()
+			{
+				return m_body;
+			}
+
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_identifier);
+				visitor(m_start);
+
+				if (m_end)
+					visitor(m_end);
+
+				visitor(m_body);
+			}
+
+		private:
+			Node* m_identifier = nullptr;
+
+			/**
+			 * The start of the range, or the array
+			 * being gone through.
+			 */
+			Node* m_start = nullptr;
+
+			Node* m_end = nullptr;
+
+			Node* m_body = nullptr;
+
+		};
+	}
+}
\ No newline at end of file
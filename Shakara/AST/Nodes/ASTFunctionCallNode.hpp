@@ -22,12 +22,95 @@ namespace Shakara
 			BOOLEAN_CAST    = 0x07,
 
 			PUSH_COLLECTION = 0x08,
-			POP_COLLECTION  = 0x09
+			POP_COLLECTION  = 0x09,
+
+			/**
+			 * Calls for grabbing part of a string,
+			 * either by a length or an end index
+			 */
+			SUBSTRING       = 0x0A,
+			SLICE           = 0x0B,
+
+			/**
+			 * Calls for splitting a string into an
+			 * array, and joining an array into a string
+			 */
+			SPLIT           = 0x0C,
+			JOIN            = 0x0D,
+
+			/**
+			 * Calls for math over whole arrays
+			 * of integers or decimals
+			 */
+			SUM             = 0x0E,
+			MINIMUM         = 0x0F,
+			MAXIMUM         = 0x10,
+			DOT             = 0x11,
+			SCALE           = 0x12,
+			ADD_EACH        = 0x13,
+			COUNT           = 0x14,
+
+			/**
+			 * Calls for checking whether a map
+			 * has a key, and grabbing every key
+			 */
+			HAS_KEY         = 0x15,
+			KEYS            = 0x16,
+
+			/**
+			 * Calls for sorting an array into a new
+			 * one, smallest or largest first
+			 */
+			SORT            = 0x17,
+			SORT_DESCENDING = 0x18,
+
+			/**
+			 * Calls for finding a value within an array,
+			 * either anywhere, or within a sorted array
+			 */
+			INDEX_OF        = 0x19,
+			BINARY_SEARCH   = 0x1A,
+			LOWER_BOUND     = 0x1B,
+
+			/**
+			 * Calls for creating a matrix, and for
+			 * math over whole matrices
+			 */
+			MATRIX          = 0x1C,
+			MATRIX_MULTIPLY = 0x1D,
+			TRANSPOSE       = 0x1E,
+			ROW_SUMS        = 0x1F,
+			COLUMN_SUMS     = 0x20,
+			ROWS            = 0x21,
+			COLUMNS         = 0x22
 		};
 
+		class FunctionDeclaration;
+
+		class WhileStatement;
+
 		class FunctionCall : public Node
 		{
 		public:
+			FunctionCall() = default;
+
+			/**
+			 * Copies the call along with its arguments,
+			 * but not anything inlined into it.
+			 */
+			FunctionCall(const FunctionCall& rhs)
+			{
+				m_type             = rhs.Type();
+				m_line             = rhs.Line();
+				m_column           = rhs.Column();
+				m_identifier       = rhs.m_identifier->Clone();
+				m_flags            = rhs.m_flags;
+				m_argumentsChecked = rhs.m_argumentsChecked;
+
+				for (size_t index = 0; index < rhs.m_arguments.size(); index++)
+					InsertArgument(rhs.m_arguments[index]->Clone());
+			}
+
 			~FunctionCall()
 			{
 				delete m_identifier;
@@ -36,6 +119,8 @@ namespace Shakara
 					delete m_arguments[index];
 
 				m_arguments.clear();
+
+				delete m_inlined;
 			}
 
 			inline FunctionCall& Identifier(Node* node)
@@ -74,12 +159,125 @@ namespace Shakara
 				return m_arguments;
 			}
 
+			/**
+			 * Set by the checker once the argument count
+			 * is verified against the only declaration of
+			 * the called function, so the interpreter can
+			 * skip comparing it on each call.
+			 */
+			inline FunctionCall& ArgumentsChecked(bool state)
+			{
+				m_argumentsChecked = state;
+
+				return *this;
+			}
+
+			inline bool ArgumentsChecked() const
+			{
+				return m_argumentsChecked;
+			}
+
+			/**
+			 * Set by the builder for calls being returned,
+			 * which the interpreter runs by reusing the
+			 * frame of the function returning them.
+			 */
+			inline FunctionCall& TailCall(bool state)
+			{
+				m_tailCall = state;
+
+				return *this;
+			}
+
+			inline bool TailCall() const
+			{
+				return m_tailCall;
+			}
+
+			/**
+			 * Set by the inliner to the body of the called
+			 * function, with its arguments substituted in,
+			 * which is ran in place of calling it for as
+			 * long as the declaration is the one called.
+			 *
+			 * The expression is owned by the call.
+			 */
+			inline FunctionCall& Inline(Node* expression, FunctionDeclaration* declaration)
+			{
+				delete m_inlined;
+
+				m_inlined            = expression;
+				m_inlinedDeclaration = declaration;
+
+				return *this;
+			}
+
+			inline Node* Inlined() const
+			{
+				return m_inlined;
+			}
+
+			inline FunctionDeclaration* InlinedDeclaration() const
+			{
+				return m_inlinedDeclaration;
+			}
+
+			/**
+			 * Set by the hoister for calls which always return
+			 * the same value while a loop runs, to the loop and
+			 * the slot of the call's value within it.
+			 */
+			inline FunctionCall& Hoist(WhileStatement* loop, size_t slot)
+			{
+				m_hoistedLoop = loop;
+				m_hoistedSlot = slot;
+
+				return *this;
+			}
+
+			inline WhileStatement* HoistedLoop() const
+			{
+				return m_hoistedLoop;
+			}
+
+			inline size_t HoistedSlot() const
+			{
+				return m_hoistedSlot;
+			}
+
+			Node* Clone()
+			{
+				return new FunctionCall(*this);
+			}
+
+			/**
+			 * The inlined expression isn't visited, as
+			 * it is only a copy of the function's body.
+			 */
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_identifier);
+
+				for (size_t index = 0; index < m_arguments.size(); index++)
+					visitor(m_arguments[index]);
+			}
+
 		private:
 			Node*              m_identifier = nullptr;
 
 			std::vector<Node*> m_arguments;
 
-			CallFlags          m_flags      = CallFlags::NONE;
+			CallFlags          m_flags            = CallFlags::NONE;
+
+			bool               m_argumentsChecked = false;
+
+			bool               m_tailCall         = false;
+
+			Node*                m_inlined            = nullptr;
+			FunctionDeclaration* m_inlinedDeclaration = nullptr;
+
+			WhileStatement*      m_hoistedLoop        = nullptr;
+			size_t               m_hoistedSlot        = 0;
 
 		};
 	}
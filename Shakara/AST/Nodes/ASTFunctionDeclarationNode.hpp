@@ -61,6 +61,37 @@ namespace Shakara
 				return m_body;
 			}
 
+			/**
+			 * Set by the checker for functions which only
+			 * read their arguments and their own variables,
+			 * never print or change an array, and only call
+			 * other pure functions.
+			 *
+			 * Calling one with the same arguments always
+			 * returns the same value.
+			 */
+			inline FunctionDeclaration& Pure(bool state)
+			{
+				m_pure = state;
+
+				return *this;
+			}
+
+			inline bool Pure() const
+			{
+				return m_pure;
+			}
+
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_identifier);
+
+				for (size_t index = 0; index < m_arguments.size(); index++)
+					visitor(m_arguments[index]);
+
+				visitor(m_body);
+			}
+
 		private:
 			Node*              m_identifier = nullptr;
 
@@ -68,6 +99,8 @@ namespace Shakara
 
 			Node*              m_body       = nullptr;
 
+			bool               m_pure       = false;
+
 		};
 	}
 }
\ No newline at end of file
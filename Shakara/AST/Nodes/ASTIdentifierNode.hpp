@@ -29,13 +29,38 @@ namespace Shakara
 				return m_value;
 			}
 
+			/**
+			 * Set by type inference for variables which are
+			 * only ever assigned integers, or only decimals.
+			 */
+			inline IdentifierNode& ProvenType(NodeType type)
+			{
+				m_provenType = type;
+				m_proven     = true;
+
+				return *this;
+			}
+
+			inline NodeType ProvenType() const
+			{
+				return m_provenType;
+			}
+
+			inline bool Proven() const
+			{
+				return m_proven;
+			}
+
 			Node* Clone()
 			{
 				return new IdentifierNode(*this);
 			}
 
 		private:
-			std::string m_value = "";
+			std::string m_value      = "";
+
+			NodeType    m_provenType;
+			bool        m_proven     = false;
 
 		};
 	}
@@ -76,6 +76,26 @@ namespace Shakara
 				return m_elseBlock;
 			}
 
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_condition);
+				visitor(m_body);
+
+				// The else if is always an if statement,
+				// so visit it through a base pointer
+				if (m_elseIfCondition)
+				{
+					Node* elseIf = m_elseIfCondition;
+
+					visitor(elseIf);
+
+					m_elseIfCondition = static_cast<IfStatement*>(elseIf);
+				}
+
+				if (m_elseBlock)
+					visitor(m_elseBlock);
+			}
+
 		private:
 			Node* m_condition              = nullptr;
 
@@ -0,0 +1,393 @@
+#include "../../stdafx.hpp"
+#include "ASTMapNode.hpp"
+
+#include "ASTIntegerNode.hpp"
+#include "ASTDecimalNode.hpp"
+#include "ASTStringNode.hpp"
+#include "ASTBooleanNode.hpp"
+
+// Groups of control bytes are compared with SSE2
+// when the target is known to have it
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define SHAKARA_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace Shakara;
+using namespace Shakara::AST;
+
+/**
+ * The amount of control bytes compared at once,
+ * which every table's size is a multiple of.
+ */
+static const size_t GROUP_WIDTH = 16;
+
+static const int8_t CONTROL_EMPTY   = -128;
+static const int8_t CONTROL_DELETED = -2;
+
+/**
+ * Grab a bit for each control byte within a group
+ * that is equal to the passed in value.
+ */
+static inline uint32_t MatchGroup(const int8_t* group, int8_t value)
+{
+#ifdef SHAKARA_SSE2
+	__m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+
+	return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(value))));
+#else
+	uint32_t mask = 0;
+
+	for (size_t index = 0; index < GROUP_WIDTH; index++)
+		if (group[index] == value)
+			mask |= 1u << index;
+
+	return mask;
+#endif
+}
+
+/**
+ * Grab a bit for each control byte within a group
+ * that is either empty or deleted, which are the
+ * only negative values below -1.
+ */
+static inline uint32_t MatchFree(const int8_t* group)
+{
+#ifdef SHAKARA_SSE2
+	__m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+
+	return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), control)));
+#else
+	uint32_t mask = 0;
+
+	for (size_t index = 0; index < GROUP_WIDTH; index++)
+		if (group[index] < -1)
+			mask |= 1u << index;
+
+	return mask;
+#endif
+}
+
+static inline uint32_t LowestBit(uint32_t mask)
+{
+#ifdef _MSC_VER
+	unsigned long index = 0;
+	_BitScanForward(&index, mask);
+
+	return static_cast<uint32_t>(index);
+#else
+	return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+}
+
+/**
+ * Spread the bits of a value over the whole
+ * hash, as the low bits pick the control byte
+ * and the high bits pick the group.
+ */
+static inline uint64_t Mix(uint64_t value)
+{
+	value ^= value >> 30;
+	value *= 0xBF58476D1CE4E5B9ULL;
+	value ^= value >> 27;
+	value *= 0x94D049BB133111EBULL;
+	value ^= value >> 31;
+
+	return value;
+}
+
+static inline int8_t ControlTag(uint64_t hash)
+{
+	return static_cast<int8_t>(hash & 0x7F);
+}
+
+Node* MapNode::Find(Node* key) const
+{
+	const Table& table = *m_table;
+
+	size_t slot = _FindSlot(key, _Hash(key));
+
+	if (slot == table.control.size())
+		return nullptr;
+
+	return table.entries[table.slots[slot]].value;
+}
+
+MapNode& MapNode::Set(Node* key, Node* value)
+{
+	Unshare();
+
+	Table&   table = *m_table;
+	uint64_t hash  = _Hash(key);
+	size_t   slot  = _FindSlot(key, hash);
+
+	if (slot != table.control.size())
+	{
+		Entry& entry = table.entries[table.slots[slot]];
+
+		ReleaseNode(entry.value);
+		ReleaseNode(key);
+
+		entry.value = value;
+
+		return *this;
+	}
+
+	// Rebuild once the table is seven eighths full,
+	// counting deleted slots, as they still have
+	// to be probed past
+	if ((table.used + 1) * 8 > table.control.size() * 7)
+		_Rehash(table.size + 1);
+
+	slot = _FreeSlot(hash);
+
+	if (table.control[slot] == CONTROL_EMPTY)
+		table.used++;
+
+	Entry entry;
+	entry.hash  = hash;
+	entry.key   = key;
+	entry.value = value;
+
+	table.control[slot] = ControlTag(hash);
+	table.slots[slot]   = static_cast<uint32_t>(table.entries.size());
+
+	table.entries.push_back(entry);
+	table.size++;
+
+	return *this;
+}
+
+bool MapNode::Remove(Node* key)
+{
+	size_t slot = _FindSlot(key, _Hash(key));
+
+	if (slot == m_table->control.size())
+		return false;
+
+	// Copies have the same slots, so the slot
+	// found is still valid after unsharing
+	Unshare();
+
+	Table& table = *m_table;
+	Entry& entry = table.entries[table.slots[slot]];
+
+	ReleaseNode(entry.key);
+	ReleaseNode(entry.value);
+
+	entry.key   = nullptr;
+	entry.value = nullptr;
+
+	table.control[slot] = CONTROL_DELETED;
+	table.size--;
+
+	// Drop removed entries once they are most of
+	// the entries, so that looping over the keys
+	// doesn't go over mostly removed entries
+	if (table.entries.size() > GROUP_WIDTH && table.size * 2 < table.entries.size())
+		_Rehash(table.size);
+
+	return true;
+}
+
+void MapNode::Keys(std::vector<Node*>& keys) const
+{
+	const Table& table = *m_table;
+
+	keys.reserve(keys.size() + table.size);
+
+	for (size_t index = 0; index < table.entries.size(); index++)
+		if (table.entries[index].key)
+			keys.push_back(table.entries[index].key);
+}
+
+MapNode& MapNode::Unshare()
+{
+	if (m_table.use_count() == 1)
+		return *this;
+
+	const Table&           shared = *m_table;
+	std::shared_ptr<Table> table  = std::make_shared<Table>();
+
+	table->entries = shared.entries;
+	table->control = shared.control;
+	table->slots   = shared.slots;
+	table->size    = shared.size;
+	table->used    = shared.used;
+
+	// Immortal values are shared, while anything
+	// else has to be owned by the new table
+	for (size_t index = 0; index < table->entries.size(); index++)
+	{
+		Entry& entry = table->entries[index];
+
+		if (entry.key && !entry.key->Immortal())
+			entry.key = entry.key->Clone();
+
+		if (entry.value && !entry.value->Immortal())
+			entry.value = entry.value->Clone();
+	}
+
+	m_table = table;
+
+	return *this;
+}
+
+uint64_t MapNode::_Hash(const Node* key)
+{
+	uint64_t hash = 0;
+
+	switch (key->Type())
+	{
+	case NodeType::STRING:
+		hash = static_cast<const StringNode*>(key)->Hash();
+		break;
+	case NodeType::INTEGER:
+		hash = static_cast<uint32_t>(static_cast<const IntegerNode*>(key)->Value());
+		break;
+	case NodeType::DECIMAL:
+	{
+		float    value = static_cast<const DecimalNode*>(key)->Value();
+		uint32_t bits  = 0;
+
+		// Both zeroes are equal, so they
+		// must have the same hash
+		if (value == 0.0f)
+			value = 0.0f;
+
+		std::memcpy(&bits, &value, sizeof(bits));
+
+		hash = bits;
+		break;
+	}
+	case NodeType::BOOLEAN:
+		hash = (static_cast<const BooleanNode*>(key)->Value()) ? 1 : 0;
+		break;
+	default:
+		break;
+	}
+
+	// Keys of different types are never equal, so
+	// keep them from sharing hashes, such as 1 and
+	// true
+	return Mix(hash ^ (static_cast<uint64_t>(key->Type()) << 56));
+}
+
+bool MapNode::_Equal(const Node* left, const Node* right)
+{
+	if (left->Type() != right->Type())
+		return false;
+
+	switch (left->Type())
+	{
+	case NodeType::STRING:
+		return static_cast<const StringNode*>(left)->Equals(*static_cast<const StringNode*>(right));
+	case NodeType::INTEGER:
+		return static_cast<const IntegerNode*>(left)->Value() == static_cast<const IntegerNode*>(right)->Value();
+	case NodeType::DECIMAL:
+		return static_cast<const DecimalNode*>(left)->Value() == static_cast<const DecimalNode*>(right)->Value();
+	case NodeType::BOOLEAN:
+		return static_cast<const BooleanNode*>(left)->Value() == static_cast<const BooleanNode*>(right)->Value();
+	default:
+		return false;
+	}
+}
+
+size_t MapNode::_FindSlot(const Node* key, uint64_t hash) const
+{
+	const Table& table = *m_table;
+
+	if (table.control.empty())
+		return table.control.size();
+
+	const size_t groups = table.control.size() / GROUP_WIDTH;
+	const int8_t tag    = ControlTag(hash);
+
+	size_t group = static_cast<size_t>(hash >> 7) & (groups - 1);
+
+	// Probe through the groups with a growing step,
+	// which visits every group, as the amount of
+	// groups is a power of two
+	for (size_t step = 1; step <= groups; step++)
+	{
+		const int8_t* control = table.control.data() + group * GROUP_WIDTH;
+
+		for (uint32_t mask = MatchGroup(control, tag); mask != 0; mask &= mask - 1)
+		{
+			size_t       slot  = group * GROUP_WIDTH + LowestBit(mask);
+			const Entry& entry = table.entries[table.slots[slot]];
+
+			if (entry.hash == hash && _Equal(entry.key, key))
+				return slot;
+		}
+
+		// The key would have been inserted into
+		// the first empty slot along the probe
+		if (MatchGroup(control, CONTROL_EMPTY) != 0)
+			break;
+
+		group = (group + step) & (groups - 1);
+	}
+
+	return table.control.size();
+}
+
+size_t MapNode::_FreeSlot(uint64_t hash) const
+{
+	const Table& table = *m_table;
+
+	const size_t groups = table.control.size() / GROUP_WIDTH;
+
+	size_t group = static_cast<size_t>(hash >> 7) & (groups - 1);
+
+	// The table is never full, so there is
+	// always a free slot along the probe
+	for (size_t step = 1; ; step++)
+	{
+		uint32_t mask = MatchFree(table.control.data() + group * GROUP_WIDTH);
+
+		if (mask != 0)
+			return group * GROUP_WIDTH + LowestBit(mask);
+
+		group = (group + step) & (groups - 1);
+	}
+}
+
+void MapNode::_Rehash(size_t amount)
+{
+	Table& table = *m_table;
+
+	// Keep the entries in the order they
+	// were inserted, without the removed
+	size_t live = 0;
+
+	for (size_t index = 0; index < table.entries.size(); index++)
+		if (table.entries[index].key)
+			table.entries[live++] = table.entries[index];
+
+	table.entries.resize(live);
+
+	// Leave the table under half full, so that
+	// most probes end within the first group
+	size_t capacity = GROUP_WIDTH;
+
+	while (capacity < amount * 2)
+		capacity *= 2;
+
+	table.control.assign(capacity, CONTROL_EMPTY);
+	table.slots.assign(capacity, 0);
+
+	for (size_t index = 0; index < table.entries.size(); index++)
+	{
+		size_t slot = _FreeSlot(table.entries[index].hash);
+
+		table.control[slot] = ControlTag(table.entries[index].hash);
+		table.slots[slot]   = static_cast<uint32_t>(index);
+	}
+
+	table.used = live;
+}
\ No newline at end of file
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "../ASTNode.hpp"
+#include "../ASTTypes.hpp"
+
+namespace Shakara
+{
+	namespace AST
+	{
+		/**
+		 * A node to be used as a map from keys to values.
+		 *
+		 * Within the AST, a map holds the key and value
+		 * expressions of its definition, while evaluated
+		 * maps hold a hash table of their entries.
+		 *
+		 * The table keeps entries in the order they were
+		 * inserted, and finds them through a flat array of
+		 * control bytes, each holding seven bits of the hash
+		 * of an entry, which are compared a group at a time.
+		 *
+		 * Copies of a map share its entries, and the entries
+		 * are only copied once a map sharing them is changed.
+		 */
+		class MapNode : public Node
+		{
+		public:
+			MapNode() = default;
+
+			MapNode(const MapNode& rhs)
+			{
+				m_table  = rhs.m_table;
+				m_type   = rhs.Type();
+				m_parent = rhs.Parent();
+
+				for (size_t index = 0; index < rhs.m_keys.size(); index++)
+				{
+					m_keys.push_back(rhs.m_keys[index]->Clone());
+					m_values.push_back((rhs.m_values[index]) ? rhs.m_values[index]->Clone() : nullptr);
+				}
+			}
+
+			~MapNode()
+			{
+				for (size_t index = 0; index < m_keys.size(); index++)
+				{
+					ReleaseNode(m_keys[index]);
+					ReleaseNode(m_values[index]);
+				}
+
+				m_keys.clear();
+				m_values.clear();
+			}
+
+			/**
+			 * Add a key and value pair to the definition
+			 * of the map, which is evaluated by the
+			 * interpreter.
+			 *
+			 * The value is null if the key was never
+			 * given one, which the checker reports.
+			 */
+			inline MapNode& InsertPair(Node* key, Node* value)
+			{
+				key->Parent(this);
+
+				if (value)
+					value->Parent(this);
+
+				m_keys.push_back(key);
+				m_values.push_back(value);
+
+				return *this;
+			}
+
+			inline size_t Pairs() const
+			{
+				return m_keys.size();
+			}
+
+			inline Node* PairKey(size_t index) const
+			{
+				return m_keys[index];
+			}
+
+			inline Node* PairValue(size_t index) const
+			{
+				return m_values[index];
+			}
+
+			/**
+			 * Whether a value can be used as a key, which
+			 * only the single value types can be.
+			 */
+			static inline bool Hashable(const Node* key)
+			{
+				return key->Type() == NodeType::INTEGER ||
+					   key->Type() == NodeType::DECIMAL ||
+					   key->Type() == NodeType::STRING  ||
+					   key->Type() == NodeType::BOOLEAN;
+			}
+
+			/**
+			 * The amount of entries in the map.
+			 */
+			inline size_t Size() const
+			{
+				return m_table->size;
+			}
+
+			/**
+			 * Grab the value of a key, or a null
+			 * pointer if the key isn't in the map.
+			 */
+			Node* Find(Node* key) const;
+
+			/**
+			 * Set the value of a key, taking ownership
+			 * of both of them.
+			 *
+			 * If the key is already in the map, its value
+			 * is replaced, and the passed in key released.
+			 */
+			MapNode& Set(Node* key, Node* value);
+
+			/**
+			 * Remove a key and its value, returning false
+			 * if the key isn't in the map.
+			 */
+			bool Remove(Node* key);
+
+			/**
+			 * Grab every key within the map, in the
+			 * order they were inserted.
+			 */
+			void Keys(std::vector<Node*>& keys) const;
+
+			/**
+			 * Copy the entries if they are shared with
+			 * another map, so that changing them only
+			 * changes this map.
+			 */
+			MapNode& Unshare();
+
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				for (size_t index = 0; index < m_keys.size(); index++)
+				{
+					visitor(m_keys[index]);
+
+					if (m_values[index])
+						visitor(m_values[index]);
+				}
+			}
+
+			Node* Clone()
+			{
+				return new MapNode(*this);
+			}
+
+		private:
+			/**
+			 * A key and its value, along with the hash of
+			 * the key, so the key is never hashed again
+			 * when the table grows.
+			 *
+			 * Removed entries have a null key, until the
+			 * table is next rebuilt.
+			 */
+			struct Entry
+			{
+				uint64_t hash  = 0;
+				Node*    key   = nullptr;
+				Node*    value = nullptr;
+			};
+
+			struct Table
+			{
+				~Table()
+				{
+					for (size_t index = 0; index < entries.size(); index++)
+					{
+						ReleaseNode(entries[index].key);
+						ReleaseNode(entries[index].value);
+					}
+				}
+
+				std::vector<Entry>    entries;
+
+				/**
+				 * A control byte for each slot, either empty,
+				 * deleted, or the low seven bits of the hash
+				 * of the entry in the slot.
+				 */
+				std::vector<int8_t>   control;
+
+				/**
+				 * The index of the entry held by each slot.
+				 */
+				std::vector<uint32_t> slots;
+
+				/**
+				 * The amount of entries, and the amount of
+				 * slots that aren't empty, which includes
+				 * deleted slots.
+				 */
+				size_t                size = 0;
+				size_t                used = 0;
+			};
+
+			/**
+			 * Expressions for the keys and values of the
+			 * map's definition within the AST.
+			 */
+			std::vector<Node*>     m_keys;
+			std::vector<Node*>     m_values;
+
+			std::shared_ptr<Table> m_table = std::make_shared<Table>();
+
+			static uint64_t _Hash(const Node* key);
+
+			static bool _Equal(const Node* left, const Node* right);
+
+			/**
+			 * Grab the slot holding a key, or the amount
+			 * of slots if the key isn't in the table.
+			 */
+			size_t _FindSlot(const Node* key, uint64_t hash) const;
+
+			/**
+			 * Grab the first empty or deleted slot that a
+			 * key with the hash could be inserted into.
+			 */
+			size_t _FreeSlot(uint64_t hash) const;
+
+			/**
+			 * Drop removed entries and rebuild the control
+			 * bytes with room for an amount of entries.
+			 */
+			void _Rehash(size_t amount);
+
+		};
+	}
+}
\ No newline at end of file
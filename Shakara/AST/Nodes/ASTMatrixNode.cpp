@@ -0,0 +1,2 @@
+#include "../../stdafx.hpp"
+#include "ASTMatrixNode.hpp"
\ No newline at end of file
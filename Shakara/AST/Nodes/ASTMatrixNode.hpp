@@ -0,0 +1,97 @@
+#pragma once
+
+#include "../ASTNode.hpp"
+
+namespace Shakara
+{
+	namespace AST
+	{
+		/**
+		 * A two dimensional matrix of decimals, stored
+		 * contiguously one row after another.
+		 *
+		 * Copies of a matrix share its values, and the
+		 * values are only copied once a matrix sharing
+		 * them is changed.
+		 */
+		class MatrixNode : public Node
+		{
+		public:
+			MatrixNode() = default;
+
+			MatrixNode(const MatrixNode& rhs)
+			{
+				m_values  = rhs.m_values;
+				m_rows    = rhs.m_rows;
+				m_columns = rhs.m_columns;
+				m_type    = rhs.Type();
+				m_parent  = rhs.Parent();
+			}
+
+			/**
+			 * Set the size of the matrix, with
+			 * every value starting at zero.
+			 */
+			inline MatrixNode& Shape(size_t rows, size_t columns)
+			{
+				m_rows    = rows;
+				m_columns = columns;
+				m_values  = std::make_shared<std::vector<float>>(rows * columns, 0.0f);
+
+				return *this;
+			}
+
+			/**
+			 * Replace the values of the matrix, which
+			 * must hold one value for each element.
+			 */
+			inline MatrixNode& Values(size_t rows, size_t columns, std::vector<float>&& values)
+			{
+				m_rows    = rows;
+				m_columns = columns;
+				m_values  = std::make_shared<std::vector<float>>(std::move(values));
+
+				return *this;
+			}
+
+			inline size_t Rows() const
+			{
+				return m_rows;
+			}
+
+			inline size_t Columns() const
+			{
+				return m_columns;
+			}
+
+			inline const float* Values() const
+			{
+				return m_values->data();
+			}
+
+			/**
+			 * Grab the values to be changed in place,
+			 * copying them first if they are shared.
+			 */
+			inline float* MutableValues()
+			{
+				if (m_values.use_count() != 1)
+					m_values = std::make_shared<std::vector<float>>(*m_values);
+
+				return m_values->data();
+			}
+
+			Node* Clone()
+			{
+				return new MatrixNode(*this);
+			}
+
+		private:
+			std::shared_ptr<std::vector<float>> m_values = std::make_shared<std::vector<float>>();
+
+			size_t                              m_rows    = 0;
+			size_t                              m_columns = 0;
+
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,2 @@
+#include "../../stdafx.hpp"
+#include "ASTMemberIdentifier.hpp"
\ No newline at end of file
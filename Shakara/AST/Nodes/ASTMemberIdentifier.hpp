@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../ASTNode.hpp"
+#include "ASTStructDeclarationNode.hpp"
+
+namespace Shakara
+{
+	namespace AST
+	{
+		/**
+		 * An access to a member of a struct, such as
+		 * "object.member", where the object is either
+		 * an identifier or another member access.
+		 *
+		 * The slot of the member is cached along with
+		 * the declaration it was found in, so that it
+		 * is only looked up by name again once the
+		 * access is used with a different struct.
+		 */
+		class MemberIdentifierNode : public Node
+		{
+		public:
+			MemberIdentifierNode() = default;
+
+			MemberIdentifierNode(const MemberIdentifierNode& identifier)
+			{
+				m_type   = identifier.Type();
+				m_line   = identifier.Line();
+				m_column = identifier.Column();
+				m_object = identifier.Object()->Clone();
+				m_member = identifier.Member();
+
+				m_object->Parent(this);
+			}
+
+			~MemberIdentifierNode()
+			{
+				delete m_object;
+			}
+
+			inline MemberIdentifierNode& Object(Node* object)
+			{
+				object->Parent(this);
+
+				m_object = object;
+
+				return *this;
+			}
+
+			inline Node* Object() const
+			{
+				return m_object;
+			}
+
+			inline MemberIdentifierNode& Member(const std::string& member)
+			{
+				m_member = member;
+
+				return *this;
+			}
+
+			inline const std::string& Member() const
+			{
+				return m_member;
+			}
+
+			/**
+			 * Grab the index of the member within the
+			 * passed in declaration, or NO_MEMBER if the
+			 * struct doesn't have the member.
+			 */
+			inline size_t Slot(const StructDeclaration* declaration)
+			{
+				if (declaration != m_cached)
+				{
+					m_slot   = declaration->Member(m_member);
+					m_cached = declaration;
+				}
+
+				return m_slot;
+			}
+
+			Node* Clone()
+			{
+				return new MemberIdentifierNode(*this);
+			}
+
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_object);
+			}
+
+		private:
+			Node*                    m_object = nullptr;
+
+			std::string              m_member = "";
+
+			/**
+			 * The declaration of the struct last accessed,
+			 * and the index of the member within it.
+			 */
+			const StructDeclaration* m_cached = nullptr;
+			size_t                   m_slot   = StructDeclaration::NO_MEMBER;
+
+		};
+	}
+}
\ No newline at end of file
@@ -26,6 +26,11 @@ namespace Shakara
 				return m_returned;
 			}
 
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_returned);
+			}
+
 		private:
 			Node* m_returned = nullptr;
 
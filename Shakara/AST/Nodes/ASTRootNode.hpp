@@ -48,6 +48,12 @@ namespace Shakara
 				return m_children[index];
 			}
 
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				for (size_t index = 0; index < m_children.size(); index++)
+					visitor(m_children[index]);
+			}
+
 		private:
 			std::vector<Node*> m_children;
 
@@ -6,6 +6,14 @@ namespace Shakara
 {
 	namespace AST
 	{
+		/**
+		 * A string value, which is a view into a buffer
+		 * that may be shared with other strings.
+		 *
+		 * Copies and substrings share the buffer of the
+		 * string they were made from, and the buffer is
+		 * only copied once a string sharing it is changed.
+		 */
 		class StringNode : public Node
 		{
 		public:
@@ -13,21 +21,143 @@ namespace Shakara
 
 			StringNode(const StringNode& rhs)
 			{
-				m_value  = rhs.Value();
+				m_buffer = rhs.m_buffer;
+				m_offset = rhs.m_offset;
+				m_length = rhs.m_length;
+				m_hash   = rhs.m_hash;
+				m_hashed = rhs.m_hashed;
 				m_type   = rhs.Type();
 				m_parent = rhs.Parent();
 			}
 
 			inline StringNode& Value(const std::string& value)
 			{
-				m_value = value;
+				m_buffer = std::make_shared<std::string>(value);
+				m_offset = 0;
+				m_length = value.size();
+				m_hashed = false;
 
 				return *this;
 			}
 
+			/**
+			 * Grab the value as a whole string.
+			 *
+			 * A view into only part of a buffer is
+			 * copied into its own buffer first, so
+			 * prefer Data() and Length() for reads
+			 * that don't need a std::string.
+			 */
 			inline const std::string& Value() const
 			{
-				return m_value;
+				static const std::string empty = "";
+
+				if (!m_buffer)
+					return empty;
+
+				if (m_offset != 0 || m_length != m_buffer->size())
+					_Detach(0);
+
+				return *m_buffer;
+			}
+
+			inline const char* Data() const
+			{
+				return (m_buffer) ? m_buffer->data() + m_offset : "";
+			}
+
+			inline size_t Length() const
+			{
+				return m_length;
+			}
+
+			inline bool Equals(const StringNode& rhs) const
+			{
+				return m_length == rhs.m_length &&
+					std::memcmp(Data(), rhs.Data(), m_length) == 0;
+			}
+
+			/**
+			 * Grab a hash of the value, which is only
+			 * computed the first time it is needed, so
+			 * that strings used as keys over and over
+			 * are only ever hashed once.
+			 */
+			inline uint64_t Hash() const
+			{
+				if (m_hashed)
+					return m_hash;
+
+				// FNV-1a
+				uint64_t    hash = 14695981039346656037ULL;
+				const char* data = Data();
+
+				for (size_t index = 0; index < m_length; index++)
+				{
+					hash ^= static_cast<uint8_t>(data[index]);
+					hash *= 1099511628211ULL;
+				}
+
+				m_hash   = hash;
+				m_hashed = true;
+
+				return m_hash;
+			}
+
+			/**
+			 * Make room for an amount of characters to
+			 * be appended without growing the buffer.
+			 */
+			inline StringNode& Reserve(size_t extra)
+			{
+				if (!m_buffer || m_buffer.use_count() != 1)
+					_Detach(extra);
+				else
+					m_buffer->reserve(m_offset + m_length + extra);
+
+				return *this;
+			}
+
+			/**
+			 * Append to the end of the current value.
+			 *
+			 * If the buffer isn't shared, it is grown in
+			 * place, otherwise it is copied first.
+			 */
+			inline StringNode& Append(const char* data, size_t length)
+			{
+				if (!m_buffer || m_buffer.use_count() != 1)
+					_Detach(length);
+				else
+					m_buffer->resize(m_offset + m_length);
+
+				m_buffer->append(data, length);
+				m_length += length;
+				m_hashed  = false;
+
+				return *this;
+			}
+
+			inline StringNode& Append(const StringNode& rhs)
+			{
+				return Append(rhs.Data(), rhs.Length());
+			}
+
+			/**
+			 * Create a new string viewing part of this
+			 * one, sharing its buffer.
+			 *
+			 * The range must be within the string.
+			 */
+			inline StringNode* View(size_t offset, size_t length) const
+			{
+				StringNode* view = new StringNode(*this);
+				view->m_parent = nullptr;
+				view->m_offset = m_offset + offset;
+				view->m_length = length;
+				view->m_hashed = false;
+
+				return view;
 			}
 
 			Node* Clone()
@@ -36,7 +166,34 @@ namespace Shakara
 			}
 
 		private:
-			std::string m_value = "";
+			/**
+			 * The buffer being viewed, and the range
+			 * of it that is this string's value.
+			 *
+			 * Mutable, as reading the whole value of a
+			 * view copies it into its own buffer.
+			 */
+			mutable std::shared_ptr<std::string> m_buffer;
+			mutable size_t                       m_offset = 0;
+			size_t                               m_length = 0;
+
+			mutable uint64_t                     m_hash   = 0;
+			mutable bool                         m_hashed = false;
+
+			/**
+			 * Copy the viewed range into a buffer owned
+			 * only by this string, with room for extra
+			 * characters to be appended.
+			 */
+			inline void _Detach(size_t extra) const
+			{
+				std::shared_ptr<std::string> buffer = std::make_shared<std::string>();
+				buffer->reserve(m_length + extra);
+				buffer->append(Data(), m_length);
+
+				m_buffer = buffer;
+				m_offset = 0;
+			}
 
 		};
 	}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "../ASTNode.hpp"
+#include "../ASTTypes.hpp"
+#include "ASTRootNode.hpp"
+#include "ASTIdentifierNode.hpp"
+#include "ASTAssignmentNode.hpp"
+#include "ASTFunctionDeclarationNode.hpp"
+
+namespace Shakara
+{
+	namespace AST
+	{
+		/**
+		 * The definition of a struct, made of fields with
+		 * their default values, and member functions.
+		 *
+		 * The layout of every instance, called its shape,
+		 * is worked out once when the body is set, with
+		 * each field given the index of a slot within the
+		 * instance, and each member function an index
+		 * after every field.
+		 */
+		class StructDeclaration : public Node
+		{
+		public:
+			/**
+			 * The index of a name that isn't
+			 * a member of the struct.
+			 */
+			static const size_t NO_MEMBER = static_cast<size_t>(-1);
+
+			~StructDeclaration()
+			{
+				delete m_identifier;
+				delete m_body;
+			}
+
+			inline StructDeclaration& Identifier(Node* node)
+			{
+				node->Parent(this);
+
+				m_identifier = node;
+
+				return *this;
+			}
+
+			inline Node* Identifier() const
+			{
+				return m_identifier;
+			}
+
+			/**
+			 * Set the statements within the struct, and
+			 * lay out a member for each field assignment
+			 * and function declaration among them.
+			 *
+			 * Any other statement is left for the checker
+			 * to report, and only the first member with a
+			 * name is used.
+			 */
+			inline StructDeclaration& Body(RootNode* body)
+			{
+				body->Parent(this);
+
+				m_body = body;
+
+				m_fields.clear();
+				m_methods.clear();
+				m_members.clear();
+
+				for (size_t index = 0; index < body->Children(); index++)
+				{
+					Node* statement = (*body)[index];
+
+					if (
+						statement->Type() == NodeType::ASSIGN &&
+						static_cast<AssignmentNode*>(statement)->GetIdentifier()->Type() == NodeType::IDENTIFIER &&
+						m_members.insert(std::make_pair(_Name(statement), m_fields.size())).second
+					)
+						m_fields.push_back(index);
+				}
+
+				for (size_t index = 0; index < body->Children(); index++)
+				{
+					Node* statement = (*body)[index];
+
+					if (
+						statement->Type() == NodeType::FUNCTION &&
+						m_members.insert(std::make_pair(_Name(statement), m_fields.size() + m_methods.size())).second
+					)
+						m_methods.push_back(index);
+				}
+
+				return *this;
+			}
+
+			inline RootNode* Body() const
+			{
+				return static_cast<RootNode*>(m_body);
+			}
+
+			inline size_t Fields() const
+			{
+				return m_fields.size();
+			}
+
+			inline const std::string& FieldName(size_t index) const
+			{
+				return _Name((*Body())[m_fields[index]]);
+			}
+
+			/**
+			 * Grab the expression for the default
+			 * value of a field.
+			 */
+			inline Node* FieldValue(size_t index) const
+			{
+				return static_cast<AssignmentNode*>((*Body())[m_fields[index]])->GetAssignment();
+			}
+
+			inline size_t Methods() const
+			{
+				return m_methods.size();
+			}
+
+			inline FunctionDeclaration* Method(size_t index) const
+			{
+				return static_cast<FunctionDeclaration*>((*Body())[m_methods[index]]);
+			}
+
+			/**
+			 * Grab the index of a member by its name,
+			 * which is the slot of a field, or the amount
+			 * of fields plus the index of a method.
+			 */
+			inline size_t Member(const std::string& name) const
+			{
+				auto find = m_members.find(name);
+
+				return (find != m_members.end()) ? find->second : NO_MEMBER;
+			}
+
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_identifier);
+				visitor(m_body);
+			}
+
+		private:
+			Node*                                   m_identifier = nullptr;
+
+			Node*                                   m_body       = nullptr;
+
+			/**
+			 * The index within the body of the statement
+			 * declaring each field and method.
+			 *
+			 * Indexes are kept rather than the statements
+			 * themselves, so that passes over the AST can
+			 * replace the statements.
+			 */
+			std::vector<size_t>                     m_fields;
+			std::vector<size_t>                     m_methods;
+
+			std::unordered_map<std::string, size_t> m_members;
+
+			static inline const std::string& _Name(Node* statement)
+			{
+				if (statement->Type() == NodeType::FUNCTION)
+					return static_cast<IdentifierNode*>(static_cast<FunctionDeclaration*>(statement)->Identifier())->Value();
+
+				return static_cast<IdentifierNode*>(static_cast<AssignmentNode*>(statement)->GetIdentifier())->Value();
+			}
+
+		};
+	}
+}
\ No newline at end of file
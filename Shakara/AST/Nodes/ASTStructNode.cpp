@@ -0,0 +1,2 @@
+#include "../../stdafx.hpp"
+#include "ASTStructNode.hpp"
\ No newline at end of file
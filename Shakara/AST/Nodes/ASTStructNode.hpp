@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../ASTNode.hpp"
+#include "ASTStructDeclarationNode.hpp"
+
+namespace Shakara
+{
+	namespace AST
+	{
+		/**
+		 * An instance of a struct, holding the value of
+		 * each field in a slot laid out by the shape of
+		 * its declaration.
+		 *
+		 * Member functions aren't held by instances, and
+		 * are found through the declaration instead.
+		 */
+		class StructNode : public Node
+		{
+		public:
+			StructNode() = default;
+
+			StructNode(const StructNode& rhs)
+			{
+				m_declaration = rhs.m_declaration;
+				m_type        = rhs.Type();
+				m_parent      = rhs.Parent();
+
+				m_slots.reserve(rhs.m_slots.size());
+
+				// Copies are values of their own, so every
+				// field is copied, besides shared constants
+				for (size_t index = 0; index < rhs.m_slots.size(); index++)
+				{
+					Node* slot = rhs.m_slots[index];
+
+					m_slots.push_back((slot && !slot->Immortal()) ? slot->Clone() : slot);
+				}
+			}
+
+			~StructNode()
+			{
+				for (size_t index = 0; index < m_slots.size(); index++)
+					ReleaseNode(m_slots[index]);
+
+				m_slots.clear();
+			}
+
+			/**
+			 * Set the declaration this is an instance of,
+			 * creating an empty slot for each field.
+			 */
+			inline StructNode& Declaration(StructDeclaration* declaration)
+			{
+				m_declaration = declaration;
+
+				m_slots.assign(declaration->Fields(), nullptr);
+
+				return *this;
+			}
+
+			inline StructDeclaration* Declaration() const
+			{
+				return m_declaration;
+			}
+
+			inline Node* Slot(size_t index) const
+			{
+				return m_slots[index];
+			}
+
+			/**
+			 * Grab where the value of a field is held, so
+			 * it can be changed without finding it again.
+			 */
+			inline Node** SlotAddress(size_t index)
+			{
+				return &m_slots[index];
+			}
+
+			/**
+			 * Set the value of a field, taking ownership
+			 * of it and releasing the previous value.
+			 */
+			inline StructNode& Slot(size_t index, Node* value)
+			{
+				if (m_slots[index] != value)
+					ReleaseNode(m_slots[index]);
+
+				m_slots[index] = value;
+
+				return *this;
+			}
+
+			Node* Clone()
+			{
+				return new StructNode(*this);
+			}
+
+		private:
+			StructDeclaration* m_declaration = nullptr;
+
+			std::vector<Node*> m_slots;
+
+		};
+	}
+}
\ No newline at end of file
@@ -42,11 +42,59 @@ namespace Shakara
 				return m_body;
 			}
 
+			/**
+			 * Set by the hoister to the amount of expressions
+			 * within the loop which never change while it runs.
+			 */
+			inline WhileStatement& Hoisted(size_t count)
+			{
+				m_hoisted = count;
+
+				return *this;
+			}
+
+			inline size_t Hoisted() const
+			{
+				return m_hoisted;
+			}
+
+			/**
+			 * Set the values of the hoisted expressions for
+			 * the loop currently running, returning those of
+			 * any run of it this one is nested within.
+			 *
+			 * Each value is nullptr until its expression is
+			 * first evaluated.
+			 */
+			inline std::vector<Node*>* HoistedValues(std::vector<Node*>* values)
+			{
+				std::vector<Node*>* previous = m_values;
+
+				m_values = values;
+
+				return previous;
+			}
+
+			inline Node*& HoistedValue(size_t slot)
+			{
+				return (*m_values)[slot];
+			}
+
+			void VisitChildren(const std::function<void(Node*&)>& visitor)
+			{
+				visitor(m_condition);
+				visitor(m_body);
+			}
+
 		private:
 			Node* m_condition = nullptr;
 
 			Node* m_body = nullptr;
 
+			size_t              m_hoisted = 0;
+
+			std::vector<Node*>* m_values  = nullptr;
+
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,737 @@
+#include "../stdafx.hpp"
+#include "ArrayKernels.hpp"
+
+#include <thread>
+
+// SSE2 is always there on x64, and on x86 only
+// when the compiler is told it can be used
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define SHAKARA_SSE2 1
+#include <emmintrin.h>
+#endif
+
+using namespace Shakara;
+
+#ifdef SHAKARA_SSE2
+/**
+ * Multiply four pairs of integers, keeping the low 32-bits
+ * of each product, as SSE2 only multiplies two at a time
+ */
+static inline __m128i MultiplyIntegers(__m128i left, __m128i right)
+{
+	__m128i even = _mm_mul_epu32(left, right);
+	__m128i odd  = _mm_mul_epu32(_mm_srli_epi64(left, 32), _mm_srli_epi64(right, 32));
+
+	return _mm_unpacklo_epi32(
+		_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+		_mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))
+	);
+}
+
+/**
+ * Pick each lane of either side depending on a mask,
+ * as SSE2 has no integer minimum or maximum
+ */
+static inline __m128i SelectIntegers(__m128i mask, __m128i left, __m128i right)
+{
+	return _mm_or_si128(_mm_and_si128(mask, left), _mm_andnot_si128(mask, right));
+}
+
+static inline int32_t HorizontalSum(__m128i values)
+{
+	int32_t lanes[4];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), values);
+
+	return static_cast<int32_t>(
+		static_cast<uint32_t>(lanes[0]) + static_cast<uint32_t>(lanes[1]) +
+		static_cast<uint32_t>(lanes[2]) + static_cast<uint32_t>(lanes[3])
+	);
+}
+
+static inline float HorizontalSum(__m128 values)
+{
+	float lanes[4];
+	_mm_storeu_ps(lanes, values);
+
+	return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+#endif
+
+/**
+ * Add and multiply integers as unsigned, so that
+ * overflowing wraps around rather than being undefined
+ */
+static inline int32_t WrapAdd(int32_t left, int32_t right)
+{
+	return static_cast<int32_t>(static_cast<uint32_t>(left) + static_cast<uint32_t>(right));
+}
+
+static inline int32_t WrapMultiply(int32_t left, int32_t right)
+{
+	return static_cast<int32_t>(static_cast<uint32_t>(left) * static_cast<uint32_t>(right));
+}
+
+int32_t Kernels::SumIntegers(const int32_t* values, size_t size)
+{
+	size_t  index  = 0;
+	int32_t result = 0;
+
+#ifdef SHAKARA_SSE2
+	__m128i sum = _mm_setzero_si128();
+
+	for (; index + 4 <= size; index += 4)
+		sum = _mm_add_epi32(sum, _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index)));
+
+	result = HorizontalSum(sum);
+#endif
+
+	for (; index < size; index++)
+		result = WrapAdd(result, values[index]);
+
+	return result;
+}
+
+float Kernels::SumDecimals(const float* values, size_t size)
+{
+	size_t index  = 0;
+	float  result = 0.0f;
+
+#ifdef SHAKARA_SSE2
+	__m128 sum = _mm_setzero_ps();
+
+	for (; index + 4 <= size; index += 4)
+		sum = _mm_add_ps(sum, _mm_loadu_ps(values + index));
+
+	result = HorizontalSum(sum);
+#endif
+
+	for (; index < size; index++)
+		result += values[index];
+
+	return result;
+}
+
+int32_t Kernels::MinIntegers(const int32_t* values, size_t size)
+{
+	size_t  index  = 0;
+	int32_t result = values[0];
+
+#ifdef SHAKARA_SSE2
+	if (size >= 4)
+	{
+		__m128i minimum = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+
+		for (index = 4; index + 4 <= size; index += 4)
+		{
+			__m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index));
+
+			minimum = SelectIntegers(_mm_cmplt_epi32(current, minimum), current, minimum);
+		}
+
+		int32_t lanes[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), minimum);
+
+		result = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+	}
+#endif
+
+	for (; index < size; index++)
+		result = std::min(result, values[index]);
+
+	return result;
+}
+
+float Kernels::MinDecimals(const float* values, size_t size)
+{
+	size_t index  = 0;
+	float  result = values[0];
+
+#ifdef SHAKARA_SSE2
+	if (size >= 4)
+	{
+		__m128 minimum = _mm_loadu_ps(values);
+
+		for (index = 4; index + 4 <= size; index += 4)
+			minimum = _mm_min_ps(minimum, _mm_loadu_ps(values + index));
+
+		float lanes[4];
+		_mm_storeu_ps(lanes, minimum);
+
+		result = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+	}
+#endif
+
+	for (; index < size; index++)
+		result = std::min(result, values[index]);
+
+	return result;
+}
+
+int32_t Kernels::MaxIntegers(const int32_t* values, size_t size)
+{
+	size_t  index  = 0;
+	int32_t result = values[0];
+
+#ifdef SHAKARA_SSE2
+	if (size >= 4)
+	{
+		__m128i maximum = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+
+		for (index = 4; index + 4 <= size; index += 4)
+		{
+			__m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index));
+
+			maximum = SelectIntegers(_mm_cmpgt_epi32(current, maximum), current, maximum);
+		}
+
+		int32_t lanes[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), maximum);
+
+		result = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+	}
+#endif
+
+	for (; index < size; index++)
+		result = std::max(result, values[index]);
+
+	return result;
+}
+
+float Kernels::MaxDecimals(const float* values, size_t size)
+{
+	size_t index  = 0;
+	float  result = values[0];
+
+#ifdef SHAKARA_SSE2
+	if (size >= 4)
+	{
+		__m128 maximum = _mm_loadu_ps(values);
+
+		for (index = 4; index + 4 <= size; index += 4)
+			maximum = _mm_max_ps(maximum, _mm_loadu_ps(values + index));
+
+		float lanes[4];
+		_mm_storeu_ps(lanes, maximum);
+
+		result = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+	}
+#endif
+
+	for (; index < size; index++)
+		result = std::max(result, values[index]);
+
+	return result;
+}
+
+int32_t Kernels::DotIntegers(const int32_t* left, const int32_t* right, size_t size)
+{
+	size_t  index  = 0;
+	int32_t result = 0;
+
+#ifdef SHAKARA_SSE2
+	__m128i sum = _mm_setzero_si128();
+
+	for (; index + 4 <= size; index += 4)
+		sum = _mm_add_epi32(
+			sum,
+			MultiplyIntegers(
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(left + index)),
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(right + index))
+			)
+		);
+
+	result = HorizontalSum(sum);
+#endif
+
+	for (; index < size; index++)
+		result = WrapAdd(result, WrapMultiply(left[index], right[index]));
+
+	return result;
+}
+
+float Kernels::DotDecimals(const float* left, const float* right, size_t size)
+{
+	size_t index  = 0;
+	float  result = 0.0f;
+
+#ifdef SHAKARA_SSE2
+	__m128 sum = _mm_setzero_ps();
+
+	for (; index + 4 <= size; index += 4)
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(left + index), _mm_loadu_ps(right + index)));
+
+	result = HorizontalSum(sum);
+#endif
+
+	for (; index < size; index++)
+		result += left[index] * right[index];
+
+	return result;
+}
+
+void Kernels::ScaleIntegers(const int32_t* values, int32_t factor, int32_t* result, size_t size)
+{
+	size_t index = 0;
+
+#ifdef SHAKARA_SSE2
+	__m128i factors = _mm_set1_epi32(factor);
+
+	for (; index + 4 <= size; index += 4)
+		_mm_storeu_si128(
+			reinterpret_cast<__m128i*>(result + index),
+			MultiplyIntegers(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index)), factors)
+		);
+#endif
+
+	for (; index < size; index++)
+		result[index] = WrapMultiply(values[index], factor);
+}
+
+void Kernels::ScaleDecimals(const float* values, float factor, float* result, size_t size)
+{
+	size_t index = 0;
+
+#ifdef SHAKARA_SSE2
+	__m128 factors = _mm_set1_ps(factor);
+
+	for (; index + 4 <= size; index += 4)
+		_mm_storeu_ps(result + index, _mm_mul_ps(_mm_loadu_ps(values + index), factors));
+#endif
+
+	for (; index < size; index++)
+		result[index] = values[index] * factor;
+}
+
+void Kernels::AddIntegers(const int32_t* left, const int32_t* right, int32_t* result, size_t size)
+{
+	size_t index = 0;
+
+#ifdef SHAKARA_SSE2
+	for (; index + 4 <= size; index += 4)
+		_mm_storeu_si128(
+			reinterpret_cast<__m128i*>(result + index),
+			_mm_add_epi32(
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(left + index)),
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(right + index))
+			)
+		);
+#endif
+
+	for (; index < size; index++)
+		result[index] = WrapAdd(left[index], right[index]);
+}
+
+void Kernels::AddDecimals(const float* left, const float* right, float* result, size_t size)
+{
+	size_t index = 0;
+
+#ifdef SHAKARA_SSE2
+	for (; index + 4 <= size; index += 4)
+		_mm_storeu_ps(result + index, _mm_add_ps(_mm_loadu_ps(left + index), _mm_loadu_ps(right + index)));
+#endif
+
+	for (; index < size; index++)
+		result[index] = left[index] + right[index];
+}
+
+size_t Kernels::CountIntegers(const int32_t* values, size_t size, int32_t value)
+{
+	size_t index  = 0;
+	size_t result = 0;
+
+#ifdef SHAKARA_SSE2
+	__m128i compared = _mm_set1_epi32(value);
+
+	// Each matching lane is all ones, so the mask
+	// has four bits set for each match
+	for (; index + 4 <= size; index += 4)
+	{
+		int mask = _mm_movemask_epi8(
+			_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index)), compared)
+		);
+
+		result += static_cast<size_t>(
+			((mask & 0x000F) != 0) + ((mask & 0x00F0) != 0) +
+			((mask & 0x0F00) != 0) + ((mask & 0xF000) != 0)
+		);
+	}
+#endif
+
+	for (; index < size; index++)
+		result += (values[index] == value) ? 1 : 0;
+
+	return result;
+}
+
+size_t Kernels::CountDecimals(const float* values, size_t size, float value)
+{
+	size_t index  = 0;
+	size_t result = 0;
+
+#ifdef SHAKARA_SSE2
+	__m128 compared = _mm_set1_ps(value);
+
+	for (; index + 4 <= size; index += 4)
+	{
+		int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(values + index), compared));
+
+		result += static_cast<size_t>((mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1));
+	}
+#endif
+
+	for (; index < size; index++)
+		result += (values[index] == value) ? 1 : 0;
+
+	return result;
+}
+
+#ifdef SHAKARA_SSE2
+/**
+ * Grab the first lane set within a mask
+ * of four lanes, which can't be empty
+ */
+static inline size_t LowestLane(int mask)
+{
+	if (mask & 1)
+		return 0;
+	else if (mask & 2)
+		return 1;
+	else if (mask & 4)
+		return 2;
+
+	return 3;
+}
+#endif
+
+size_t Kernels::IndexOfIntegers(const int32_t* values, size_t size, int32_t value)
+{
+	size_t index = 0;
+
+#ifdef SHAKARA_SSE2
+	__m128i compared = _mm_set1_epi32(value);
+
+	for (; index + 4 <= size; index += 4)
+	{
+		int mask = _mm_movemask_ps(_mm_castsi128_ps(
+			_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index)), compared)
+		));
+
+		if (mask)
+			return index + LowestLane(mask);
+	}
+#endif
+
+	for (; index < size; index++)
+		if (values[index] == value)
+			return index;
+
+	return size;
+}
+
+size_t Kernels::IndexOfDecimals(const float* values, size_t size, float value)
+{
+	size_t index = 0;
+
+#ifdef SHAKARA_SSE2
+	__m128 compared = _mm_set1_ps(value);
+
+	for (; index + 4 <= size; index += 4)
+	{
+		int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(values + index), compared));
+
+		if (mask)
+			return index + LowestLane(mask);
+	}
+#endif
+
+	for (; index < size; index++)
+		if (values[index] == value)
+			return index;
+
+	return size;
+}
+
+/**
+ * Below this many values, sorting on a single
+ * thread is quicker than starting any threads
+ */
+static const size_t PARALLEL_SORT_SIZE = 1 << 16;
+
+/**
+ * Sort a run of values for each thread, then merge
+ * neighbouring runs in rounds until one is left,
+ * with each merge within a round on its own thread.
+ */
+template <typename T, typename Compare>
+static void SortValues(T* values, size_t size, Compare compare)
+{
+	size_t threads = std::thread::hardware_concurrency();
+
+	if (size < PARALLEL_SORT_SIZE || threads < 2)
+	{
+		std::sort(values, values + size, compare);
+
+		return;
+	}
+
+	// Keep every run large enough to be worth a thread
+	size_t runs = std::min(threads, size / (PARALLEL_SORT_SIZE / 2));
+
+	std::vector<size_t> bounds;
+	bounds.reserve(runs + 1);
+
+	for (size_t run = 0; run <= runs; run++)
+		bounds.push_back(size * run / runs);
+
+	std::vector<std::thread> workers;
+	workers.reserve(runs);
+
+	for (size_t run = 1; run < runs; run++)
+	{
+		T* begin = values + bounds[run];
+		T* end   = values + bounds[run + 1];
+
+		workers.emplace_back([begin, end, compare]() {
+			std::sort(begin, end, compare);
+		});
+	}
+
+	std::sort(values + bounds[0], values + bounds[1], compare);
+
+	for (std::thread& worker : workers)
+		worker.join();
+
+	// Merge back and forth between the values and
+	// a buffer, so that each round is one copy
+	std::vector<T> buffer(size);
+
+	T* source      = values;
+	T* destination = buffer.data();
+
+	while (bounds.size() > 2)
+	{
+		std::vector<size_t> merged;
+		merged.reserve(bounds.size() / 2 + 2);
+
+		workers.clear();
+
+		for (size_t run = 0; run + 1 < bounds.size(); run += 2)
+		{
+			size_t begin = bounds[run];
+			size_t end   = bounds[std::min(run + 2, bounds.size() - 1)];
+			size_t split = bounds[run + 1];
+
+			merged.push_back(begin);
+
+			workers.emplace_back([=]() {
+				std::merge(
+					source + begin, source + split,
+					source + split, source + end,
+					destination + begin,
+					compare
+				);
+			});
+		}
+
+		merged.push_back(size);
+
+		for (std::thread& worker : workers)
+			worker.join();
+
+		std::swap(source, destination);
+
+		bounds = std::move(merged);
+	}
+
+	if (source != values)
+		std::copy(source, source + size, values);
+}
+
+void Kernels::SortIntegers(int32_t* values, size_t size, bool descending)
+{
+	if (descending)
+		SortValues(values, size, std::greater<int32_t>());
+	else
+		SortValues(values, size, std::less<int32_t>());
+}
+
+void Kernels::SortDecimals(float* values, size_t size, bool descending)
+{
+	// Anything compared to a value that isn't a number is
+	// false, so order those explicitly to keep the order strict
+	if (descending)
+		SortValues(values, size, [](float left, float right) {
+			return left > right || (left == left && right != right);
+		});
+	else
+		SortValues(values, size, [](float left, float right) {
+			return left < right || (left == left && right != right);
+		});
+}
+
+/**
+ * The width of the square blocks matrices are worked
+ * through in, so that each block stays in cache
+ */
+static const size_t MATRIX_BLOCK = 64;
+
+/**
+ * Below this many multiplications, multiplying on a
+ * single thread is quicker than starting any threads
+ */
+static const size_t PARALLEL_MULTIPLY_SIZE = 1 << 21;
+
+static void MultiplyRows(
+	const float* left,
+	const float* right,
+	float*       result,
+	size_t       begin,
+	size_t       end,
+	size_t       inner,
+	size_t       columns
+)
+{
+	std::fill(result + begin * columns, result + end * columns, 0.0f);
+
+	for (size_t rowBlock = begin; rowBlock < end; rowBlock += MATRIX_BLOCK)
+	{
+		size_t rowEnd = std::min(rowBlock + MATRIX_BLOCK, end);
+
+		for (size_t innerBlock = 0; innerBlock < inner; innerBlock += MATRIX_BLOCK)
+		{
+			size_t innerEnd = std::min(innerBlock + MATRIX_BLOCK, inner);
+
+			for (size_t columnBlock = 0; columnBlock < columns; columnBlock += MATRIX_BLOCK)
+			{
+				size_t columnEnd = std::min(columnBlock + MATRIX_BLOCK, columns);
+
+				// Add each value of the left row multiplied by
+				// the matching row of the right, so that both
+				// rows are read in order
+				for (size_t row = rowBlock; row < rowEnd; row++)
+				{
+					float* output = result + row * columns;
+
+					for (size_t step = innerBlock; step < innerEnd; step++)
+					{
+						float        factor = left[row * inner + step];
+						const float* input  = right + step * columns;
+						size_t       column = columnBlock;
+
+#ifdef SHAKARA_SSE2
+						__m128 factors = _mm_set1_ps(factor);
+
+						for (; column + 4 <= columnEnd; column += 4)
+							_mm_storeu_ps(
+								output + column,
+								_mm_add_ps(_mm_loadu_ps(output + column), _mm_mul_ps(factors, _mm_loadu_ps(input + column)))
+							);
+#endif
+
+						for (; column < columnEnd; column++)
+							output[column] += factor * input[column];
+					}
+				}
+			}
+		}
+	}
+}
+
+void Kernels::MultiplyMatrices(
+	const float* left,
+	const float* right,
+	float*       result,
+	size_t       rows,
+	size_t       inner,
+	size_t       columns
+)
+{
+	size_t threads = std::thread::hardware_concurrency();
+
+	if (rows * inner * columns < PARALLEL_MULTIPLY_SIZE || threads < 2 || rows < 2)
+	{
+		MultiplyRows(left, right, result, 0, rows, inner, columns);
+
+		return;
+	}
+
+	// Each thread fills in its own rows of the result
+	size_t parts = std::min(threads, rows);
+
+	std::vector<std::thread> workers;
+	workers.reserve(parts);
+
+	for (size_t part = 1; part < parts; part++)
+	{
+		size_t begin = rows * part / parts;
+		size_t end   = rows * (part + 1) / parts;
+
+		workers.emplace_back(MultiplyRows, left, right, result, begin, end, inner, columns);
+	}
+
+	MultiplyRows(left, right, result, 0, rows / parts, inner, columns);
+
+	for (std::thread& worker : workers)
+		worker.join();
+}
+
+void Kernels::TransposeMatrix(const float* values, float* result, size_t rows, size_t columns)
+{
+	for (size_t rowBlock = 0; rowBlock < rows; rowBlock += MATRIX_BLOCK)
+	{
+		size_t rowEnd = std::min(rowBlock + MATRIX_BLOCK, rows);
+
+		for (size_t columnBlock = 0; columnBlock < columns; columnBlock += MATRIX_BLOCK)
+		{
+			size_t columnEnd = std::min(columnBlock + MATRIX_BLOCK, columns);
+			size_t row       = rowBlock;
+
+#ifdef SHAKARA_SSE2
+			// Swap four by four squares within registers
+			for (; row + 4 <= rowEnd; row += 4)
+			{
+				size_t column = columnBlock;
+
+				for (; column + 4 <= columnEnd; column += 4)
+				{
+					__m128 first  = _mm_loadu_ps(values + row * columns + column);
+					__m128 second = _mm_loadu_ps(values + (row + 1) * columns + column);
+					__m128 third  = _mm_loadu_ps(values + (row + 2) * columns + column);
+					__m128 fourth = _mm_loadu_ps(values + (row + 3) * columns + column);
+
+					_MM_TRANSPOSE4_PS(first, second, third, fourth);
+
+					_mm_storeu_ps(result + column * rows + row, first);
+					_mm_storeu_ps(result + (column + 1) * rows + row, second);
+					_mm_storeu_ps(result + (column + 2) * rows + row, third);
+					_mm_storeu_ps(result + (column + 3) * rows + row, fourth);
+				}
+
+				for (; column < columnEnd; column++)
+					for (size_t offset = 0; offset < 4; offset++)
+						result[column * rows + row + offset] = values[(row + offset) * columns + column];
+			}
+#endif
+
+			for (; row < rowEnd; row++)
+				for (size_t column = columnBlock; column < columnEnd; column++)
+					result[column * rows + row] = values[row * columns + column];
+		}
+	}
+}
+
+void Kernels::SumRows(const float* values, float* result, size_t rows, size_t columns)
+{
+	for (size_t row = 0; row < rows; row++)
+		result[row] = SumDecimals(values + row * columns, columns);
+}
+
+void Kernels::SumColumns(const float* values, float* result, size_t rows, size_t columns)
+{
+	// Add whole rows at a time, so the
+	// values are read in order
+	std::fill(result, result + columns, 0.0f);
+
+	for (size_t row = 0; row < rows; row++)
+		AddDecimals(result, values + row * columns, result, columns);
+}
\ No newline at end of file
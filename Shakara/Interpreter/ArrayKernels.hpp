@@ -0,0 +1,91 @@
+#pragma once
+
+namespace Shakara
+{
+	/**
+	 * Loops over packed numeric values, used by the
+	 * built-in calls operating on whole arrays.
+	 *
+	 * Each one is vectorized with SSE2 when it is
+	 * available, with a scalar loop otherwise.
+	 *
+	 * Integer math wraps around on overflow, the
+	 * same as 32-bit two's complement.
+	 */
+	namespace Kernels
+	{
+		int32_t SumIntegers(const int32_t* values, size_t size);
+
+		float SumDecimals(const float* values, size_t size);
+
+		/**
+		 * The minimum and maximum kernels expect
+		 * at least one value.
+		 */
+		int32_t MinIntegers(const int32_t* values, size_t size);
+
+		float MinDecimals(const float* values, size_t size);
+
+		int32_t MaxIntegers(const int32_t* values, size_t size);
+
+		float MaxDecimals(const float* values, size_t size);
+
+		int32_t DotIntegers(const int32_t* left, const int32_t* right, size_t size);
+
+		float DotDecimals(const float* left, const float* right, size_t size);
+
+		void ScaleIntegers(const int32_t* values, int32_t factor, int32_t* result, size_t size);
+
+		void ScaleDecimals(const float* values, float factor, float* result, size_t size);
+
+		void AddIntegers(const int32_t* left, const int32_t* right, int32_t* result, size_t size);
+
+		void AddDecimals(const float* left, const float* right, float* result, size_t size);
+
+		size_t CountIntegers(const int32_t* values, size_t size, int32_t value);
+
+		size_t CountDecimals(const float* values, size_t size, float value);
+
+		/**
+		 * Grab the index of the first value equal to
+		 * the one passed in, or the size if there is
+		 * no such value.
+		 */
+		size_t IndexOfIntegers(const int32_t* values, size_t size, int32_t value);
+
+		size_t IndexOfDecimals(const float* values, size_t size, float value);
+
+		/**
+		 * Sort values in place with introsort, splitting
+		 * large arrays between threads, which each sort a
+		 * run before the runs are merged together.
+		 *
+		 * Decimals that aren't a number are sorted last.
+		 */
+		void SortIntegers(int32_t* values, size_t size, bool descending);
+
+		void SortDecimals(float* values, size_t size, bool descending);
+
+		/**
+		 * Matrices are stored one row after another.
+		 *
+		 * Multiplying works through blocks small enough
+		 * to stay in cache, with large multiplications
+		 * split by rows between threads.
+		 */
+		void MultiplyMatrices(
+			const float* left,
+			const float* right,
+			float*       result,
+			size_t       rows,
+			size_t       inner,
+			size_t       columns
+		);
+
+		void TransposeMatrix(const float* values, float* result, size_t rows, size_t columns);
+
+		void SumRows(const float* values, float* result, size_t rows, size_t columns);
+
+		void SumColumns(const float* values, float* result, size_t rows, size_t columns);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "../stdafx.hpp"
+#include "ConstantPool.hpp"
+
+#include "../AST/ASTNode.hpp"
+#include "../AST/ASTTypes.hpp"
+#include "../AST/Nodes/ASTIntegerNode.hpp"
+#include "../AST/Nodes/ASTBooleanNode.hpp"
+#include "../AST/Nodes/ASTStringNode.hpp"
+
+using namespace Shakara;
+using namespace Shakara::AST;
+
+ConstantPool::ConstantPool()
+{
+	// Create both of the boolean values
+	m_true = new BooleanNode();
+	m_true->Type(NodeType::BOOLEAN);
+	m_true->Value(true);
+	m_true->Immortal(true);
+
+	m_false = new BooleanNode();
+	m_false->Type(NodeType::BOOLEAN);
+	m_false->Value(false);
+	m_false->Immortal(true);
+
+	// Create every integer within the range
+	// up front, so that grabbing one is only
+	// an index into the vector
+	m_integers.reserve(MAX_INTEGER - MIN_INTEGER + 1);
+
+	for (int32_t value = MIN_INTEGER; value <= MAX_INTEGER; value++)
+	{
+		IntegerNode* integer = new IntegerNode();
+		integer->Type(NodeType::INTEGER);
+		integer->Value(false, value);
+		integer->Immortal(true);
+
+		m_integers.push_back(integer);
+	}
+
+	// Create the name of every type, sharing
+	// the strings of types with the same name
+	const uint8_t typeCount = static_cast<uint8_t>(NodeType::MATRIX) + 1;
+
+	m_typeNames.reserve(typeCount);
+
+	for (uint8_t type = 0; type < typeCount; type++)
+		m_typeNames.push_back(String(GetNodeTypeName(static_cast<NodeType>(type))));
+}
+
+ConstantPool::~ConstantPool()
+{
+	delete m_true;
+	delete m_false;
+
+	for (size_t index = 0; index < m_integers.size(); index++)
+		delete m_integers[index];
+
+	m_integers.clear();
+
+	// Type names are held within the strings
+	// map, so they only need to be cleared
+	m_typeNames.clear();
+
+	for (auto itr : m_strings)
+		delete itr.second;
+
+	m_strings.clear();
+}
+
+IntegerNode* ConstantPool::Integer(int32_t value)
+{
+	if (value >= MIN_INTEGER && value <= MAX_INTEGER)
+		return m_integers[value - MIN_INTEGER];
+
+	IntegerNode* integer = new IntegerNode();
+	integer->Type(NodeType::INTEGER);
+	integer->Value(false, value);
+
+	return integer;
+}
+
+StringNode* ConstantPool::TypeName(const NodeType& type)
+{
+	const size_t index = static_cast<size_t>(type);
+
+	if (index < m_typeNames.size())
+		return m_typeNames[index];
+
+	return String(GetNodeTypeName(type));
+}
+
+StringNode* ConstantPool::String(const std::string& value)
+{
+	auto find = m_strings.find(value);
+
+	if (find != m_strings.end())
+		return find->second;
+
+	StringNode* string = new StringNode();
+	string->Type(NodeType::STRING);
+	string->Value(value);
+	string->Immortal(true);
+
+	m_strings.insert(std::make_pair(value, string));
+
+	return string;
+}
+
+Node* ConstantPool::Literal(Node* literal)
+{
+	switch (literal->Type())
+	{
+	case NodeType::BOOLEAN:
+		return Boolean(static_cast<BooleanNode*>(literal)->Value());
+	case NodeType::INTEGER:
+		return Integer(static_cast<IntegerNode*>(literal)->Value());
+	case NodeType::STRING:
+		return String(static_cast<StringNode*>(literal)->Value());
+	default:
+		return literal->Clone();
+	}
+}
+
+Node* ConstantPool::Share(Node* value)
+{
+	if (value->Immortal())
+		return value;
+
+	return value->Clone();
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+
+namespace Shakara
+{
+	namespace AST
+	{
+		class Node;
+
+		class IntegerNode;
+
+		class BooleanNode;
+
+		class StringNode;
+
+		enum class NodeType : uint8_t;
+	}
+
+	/**
+	 * A pool of immutable values to be shared by
+	 * everything a single interpreter executes.
+	 *
+	 * Holds both booleans, a small range of integers,
+	 * the name of each type, and deduplicated strings.
+	 *
+	 * Each value is marked as immortal, so scopes and
+	 * arrays never delete them, and are only freed
+	 * once the pool itself is.
+	 */
+	class ConstantPool
+	{
+	public:
+		/**
+		 * The range of integers that are pooled,
+		 * anything outside of it is allocated
+		 */
+		static const int32_t MIN_INTEGER = -128;
+		static const int32_t MAX_INTEGER = 1023;
+
+		ConstantPool();
+
+		~ConstantPool();
+
+		ConstantPool(const ConstantPool&) = delete;
+
+		ConstantPool& operator=(const ConstantPool&) = delete;
+
+		inline AST::BooleanNode* Boolean(bool value) const
+		{
+			return (value) ? m_true : m_false;
+		}
+
+		/**
+		 * Grab an integer value, which is shared if
+		 * within the pooled range, otherwise a new
+		 * node is created.
+		 */
+		AST::IntegerNode* Integer(int32_t value);
+
+		/**
+		 * Grab the shared string holding the name
+		 * of the passed in type.
+		 */
+		AST::StringNode* TypeName(const AST::NodeType& type);
+
+		/**
+		 * Grab a shared string with the passed in
+		 * value, adding it to the pool if it hasn't
+		 * been used yet.
+		 */
+		AST::StringNode* String(const std::string& value);
+
+		/**
+		 * Grab a value to be used for a literal node
+		 * within the AST.
+		 *
+		 * Booleans, pooled integers, and strings are
+		 * shared, while anything else is cloned.
+		 */
+		AST::Node* Literal(AST::Node* literal);
+
+		/**
+		 * Grab a value to be stored somewhere else,
+		 * such as another variable or an array.
+		 *
+		 * Immortal values are shared, while anything
+		 * else is cloned.
+		 */
+		AST::Node* Share(AST::Node* value);
+
+	private:
+		AST::BooleanNode*                                 m_true  = nullptr;
+		AST::BooleanNode*                                 m_false = nullptr;
+
+		/**
+		 * Integers from MIN_INTEGER to MAX_INTEGER,
+		 * offset by MIN_INTEGER
+		 */
+		std::vector<AST::IntegerNode*>                    m_integers;
+
+		/**
+		 * Names for each type, indexed by the value
+		 * of the type
+		 */
+		std::vector<AST::StringNode*>                     m_typeNames;
+
+		std::unordered_map<std::string, AST::StringNode*> m_strings;
+
+	};
+}
\ No newline at end of file
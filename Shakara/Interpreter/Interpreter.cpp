@@ -3,6 +3,11 @@
 
 #include "../AST/ASTNode.hpp"
 #include "../AST/ASTTypes.hpp"
+#include "../AST/ASTChecker.hpp"
+#include "../AST/ASTInliner.hpp"
+#include "../AST/ASTHoister.hpp"
+#include "../AST/ASTRangeAnalyzer.hpp"
+#include "../AST/ASTTypeInferrer.hpp"
 #include "../AST/Nodes/ASTRootNode.hpp"
 #include "../AST/Nodes/ASTFunctionCallNode.hpp"
 #include "../AST/Nodes/ASTIntegerNode.hpp"
@@ -16,19 +21,154 @@
 #include "../AST/Nodes/ASTBooleanNode.hpp"
 #include "../AST/Nodes/ASTIfStatementNode.hpp"
 #include "../AST/Nodes/ASTWhileStatementNode.hpp"
+#include "../AST/Nodes/ASTForStatementNode.hpp"
 #include "../AST/Nodes/ASTArrayNode.hpp"
 #include "../AST/Nodes/ASTArrayElementIdentifier.hpp"
+#include "../AST/Nodes/ASTMapNode.hpp"
+#include "../AST/Nodes/ASTStructDeclarationNode.hpp"
+#include "../AST/Nodes/ASTStructNode.hpp"
+#include "../AST/Nodes/ASTMemberIdentifier.hpp"
+#include "../AST/Nodes/ASTMatrixNode.hpp"
+
+#include "ArrayKernels.hpp"
+#include "StackSegment.hpp"
 
 using namespace Shakara;
 using namespace Shakara::AST;
 
+/**
+ * Function and struct declarations are stored as the
+ * same node from the AST, so they are never released
+ * by a scope.
+ */
+static inline bool IsDeclaration(const Node* node)
+{
+	return node->Type() == NodeType::FUNCTION ||
+		   node->Type() == NodeType::STRUCT_DECLARATION;
+}
+
+/**
+ * Compare two values of the same type by the
+ * comparison operation passed in.
+ */
+template<typename T>
+static inline bool Compare(const NodeType& operation, T leftHand, T rightHand)
+{
+	switch (operation)
+	{
+	case NodeType::EQUAL_COMPARISON:
+		return leftHand == rightHand;
+	case NodeType::NOTEQUAL_COMPARISON:
+		return leftHand != rightHand;
+	case NodeType::LESS_COMPARISON:
+		return leftHand < rightHand;
+	case NodeType::GREATER_COMPARISON:
+		return leftHand > rightHand;
+	case NodeType::LESSEQUAL_COMPARISON:
+		return leftHand <= rightHand;
+	default:
+		return leftHand >= rightHand;
+	}
+}
+
+/**
+ * Apply an arithmetic operation to two integers,
+ * returning false for an operation that isn't
+ * arithmetic or a division by zero, which are
+ * left for the regular path to report.
+ */
+static inline bool Arithmetic(const NodeType& operation, int32_t leftHand, int32_t rightHand, int32_t& value)
+{
+	switch (operation)
+	{
+	case NodeType::ADD:
+		value = leftHand + rightHand;
+
+		return true;
+	case NodeType::SUBTRACT:
+		value = leftHand - rightHand;
+
+		return true;
+	case NodeType::MULTIPLY:
+		value = leftHand * rightHand;
+
+		return true;
+	case NodeType::DIVIDE:
+		if (rightHand == 0)
+			return false;
+
+		value = leftHand / rightHand;
+
+		return true;
+	case NodeType::MODULUS:
+		if (rightHand == 0)
+			return false;
+
+		value = leftHand % rightHand;
+
+		return true;
+	default:
+		return false;
+	}
+}
+
+static inline bool Arithmetic(const NodeType& operation, float leftHand, float rightHand, float& value)
+{
+	switch (operation)
+	{
+	case NodeType::ADD:
+		value = leftHand + rightHand;
+
+		return true;
+	case NodeType::SUBTRACT:
+		value = leftHand - rightHand;
+
+		return true;
+	case NodeType::MULTIPLY:
+		value = leftHand * rightHand;
+
+		return true;
+	case NodeType::DIVIDE:
+		value = leftHand / rightHand;
+
+		return true;
+	case NodeType::MODULUS:
+		value = fmod(leftHand, rightHand);
+
+		return true;
+	default:
+		return false;
+	}
+}
+
+/**
+ * Grab the slot of a field of a struct by its name,
+ * or NO_MEMBER if the struct has no such field.
+ */
+static inline size_t FieldSlot(const StructNode* instance, const std::string& identifier)
+{
+	const StructDeclaration* declaration = instance->Declaration();
+
+	size_t slot = declaration->Member(identifier);
+
+	return (slot < declaration->Fields()) ? slot : StructDeclaration::NO_MEMBER;
+}
+
 Scope::~Scope()
+{
+	Release();
+
+	parent   = nullptr;
+	receiver = nullptr;
+}
+
+void Scope::Release()
 {
 	for (auto itr : variables)
-		if (itr.second->Type() != NodeType::FUNCTION && itr.second->MarkedForDeletion())
-			delete itr.second;
+		if (!IsDeclaration(itr.second) && itr.second->MarkedForDeletion())
+			ReleaseNode(itr.second);
 
-	parent = nullptr;
+	variables.clear();
 }
 
 Node* Scope::Search(const std::string& identifier)
@@ -38,19 +178,65 @@ Node* Scope::Search(const std::string& identifier)
 	// If there is a variable found within
 	if (find != variables.end())
 		return find->second;
+
+	// Then, try the fields of the instance a
+	// member function was called on
+	if (receiver)
+	{
+		size_t slot = FieldSlot(receiver, identifier);
+
+		if (slot != StructDeclaration::NO_MEMBER)
+			return receiver->Slot(slot);
+	}
+
 	// Otherwise, try to recursively search
-	else
-		if (parent)
-			return parent->Search(identifier);
+	if (parent)
+		return parent->Search(identifier);
 
 	return nullptr;
 }
 
-void Scope::Insert(const std::string& identifier, Node* node)
+Node** Scope::Slot(const std::string& identifier)
 {
-	bool updated = false;
+	auto find = variables.find(identifier);
+
+	if (find != variables.end())
+		return &find->second;
+
+	if (receiver)
+	{
+		size_t slot = FieldSlot(receiver, identifier);
+
+		if (slot != StructDeclaration::NO_MEMBER)
+			return receiver->SlotAddress(slot);
+	}
 
 	if (parent)
+		return parent->Slot(identifier);
+
+	return nullptr;
+}
+
+bool Scope::_UpdateField(const std::string& identifier, Node* node)
+{
+	if (!receiver || variables.find(identifier) != variables.end())
+		return false;
+
+	size_t slot = FieldSlot(receiver, identifier);
+
+	if (slot == StructDeclaration::NO_MEMBER)
+		return false;
+
+	receiver->Slot(slot, node);
+
+	return true;
+}
+
+void Scope::Insert(const std::string& identifier, Node* node)
+{
+	bool updated = _UpdateField(identifier, node);
+
+	if (!updated && parent)
 		updated = parent->Update(identifier, node);
 
 	if (!updated)
@@ -61,8 +247,8 @@ void Scope::Insert(const std::string& identifier, Node* node)
 			variables.insert(std::make_pair(identifier, node));
 		else
 		{
-			if (find->second->Type() != NodeType::FUNCTION)
-				delete find->second;
+			if (!IsDeclaration(find->second))
+				ReleaseNode(find->second);
 
 			variables[identifier] = node;
 		}
@@ -71,9 +257,9 @@ void Scope::Insert(const std::string& identifier, Node* node)
 
 bool Scope::Update(const std::string& identifier, Node* node)
 {
-	bool alreadyUpdated = false;
+	bool alreadyUpdated = _UpdateField(identifier, node);
 
-	if (parent)
+	if (!alreadyUpdated && parent)
 		alreadyUpdated = parent->Update(identifier, node);
 
 	if (!alreadyUpdated)
@@ -84,8 +270,8 @@ bool Scope::Update(const std::string& identifier, Node* node)
 			return false;
 		else
 		{
-			if (find->second->Type() != NodeType::FUNCTION)
-				delete find->second;
+			if (!IsDeclaration(find->second))
+				ReleaseNode(find->second);
 
 			variables[identifier] = node;
 
@@ -93,7 +279,9 @@ bool Scope::Update(const std::string& identifier, Node* node)
 		}
 	}
 
-	return false;
+	// Updated further up, so the variable
+	// must not be inserted again below
+	return true;
 }
 
 Interpreter::Interpreter()
@@ -117,15 +305,53 @@ void Interpreter::Execute(
 {
 	Scope& currentScope = ((scope) ? *scope : m_globalScope);
 
-	// If we are in global scope, create the command arguments
-	// array
+	// If we are in global scope, check the whole AST once
+	// before running anything, and create the command
+	// arguments array
 	if (!scope)
+	{
+		// Calls are nested on top of wherever
+		// the whole AST is executed from
+		char base;
+
+		m_stackBase  = reinterpret_cast<uintptr_t>(&base);
+		m_stackUsage = FIRST_STACK_USE;
+
+		ASTChecker checker;
+		checker.ErrorHandler(m_errorHandle);
+
+		if (!checker.Check(root))
+			return;
+
+		// Only once checked, as inlining relies on
+		// the AST being valid
+		ASTInliner inliner;
+		inliner.Inline(root);
+
+		// After inlining, as inlined calls no longer
+		// stop a loop from being hoisted out of
+		ASTHoister hoister;
+		hoister.Hoist(root);
+
+		ASTRangeAnalyzer analyzer;
+		analyzer.Analyze(root);
+
+		ASTTypeInferrer inferrer;
+		inferrer.Infer(root);
+
 		_CreateCommandArgumentsArray();
+	}
+
+	// Values loaded out of packed arrays are
+	// only needed by the statement loading them
+	const size_t loaded = m_loaded.size();
 
 	// Go through each node in the AST and
 	// start executing
 	for (size_t index = 0; index < root->Children(); index++)
 	{
+		_ReleaseLoaded(loaded);
+
 		Node* node = (*root)[index];
 
 		if (node->Type() == NodeType::CALL)
@@ -160,7 +386,7 @@ void Interpreter::Execute(
 				currentScope
 			);
 
-			if (function && *returned)
+			if ((function && *returned) || m_control != LoopControl::NONE)
 				break;
 		}
 		else if (node->Type() == NodeType::WHILE_STATEMENT)
@@ -177,34 +403,49 @@ void Interpreter::Execute(
 			if (function && *returned)
 				break;
 		}
-		else if (node->Type() == NodeType::FUNCTION)
+		else if (node->Type() == NodeType::FOR_STATEMENT)
 		{
-			if (function)
-			{
-				std::cerr << "Interpreter Error! Cannot declare a function within another function!" << std::endl;
+			ForStatement* statement = static_cast<ForStatement*>(node);
 
-				if (m_errorHandle)
-					m_errorHandle();
+			_ExecuteForStatement(
+				statement,
+				function,
+				returned,
+				currentScope
+			);
 
-				continue;
-			}
+			if (function && *returned)
+				break;
+		}
+		// Function declarations, returns, breaks, and
+		// continues have been validated by the checker,
+		// so they can be ran without checking where they are
+		else if (node->Type() == NodeType::BREAK)
+		{
+			m_control = LoopControl::BREAK;
+
+			break;
+		}
+		else if (node->Type() == NodeType::CONTINUE)
+		{
+			m_control = LoopControl::CONTINUE;
 
+			break;
+		}
+		else if (node->Type() == NodeType::FUNCTION)
+		{
 			FunctionDeclaration* declaration = static_cast<FunctionDeclaration*>(node);
 
 			_ExecuteFunctionDeclaration(declaration);
 		}
-		else if (node->Type() == NodeType::RETURN)
+		else if (node->Type() == NodeType::STRUCT_DECLARATION)
 		{
-			if (!function)
-			{
-				std::cerr << "Interpreter Error! Cannot return outside of a function body!" << std::endl;
-
-				if (m_errorHandle)
-					m_errorHandle();
-
-				continue;
-			}
+			StructDeclaration* declaration = static_cast<StructDeclaration*>(node);
 
+			_ExecuteStructDeclaration(declaration);
+		}
+		else if (node->Type() == NodeType::RETURN)
+		{
 			// Grab the return node and its returned value
 			ReturnNode* returnNode = static_cast<ReturnNode*>(node);
 			Node*       returnable = returnNode->GetReturned();
@@ -214,7 +455,7 @@ void Interpreter::Execute(
 			// type
 			if (returnable->Type() == NodeType::IDENTIFIER)
 			{
-				*returned = currentScope.Search(static_cast<IdentifierNode*>(returnable)->Value())->Clone();
+				*returned = m_constants.Share(currentScope.Search(static_cast<IdentifierNode*>(returnable)->Value()));
 				(*returned)->MarkDelete(true);
 			}
 			else if (
@@ -224,7 +465,7 @@ void Interpreter::Execute(
 				returnable->Type() == NodeType::BOOLEAN
 			)
 			{
-				*returned = returnable->Clone();
+				*returned = m_constants.Literal(returnable);
 				(*returned)->MarkDelete(true);
 			}
 			else if (returnable->Type() == NodeType::BINARY_OP)
@@ -239,14 +480,56 @@ void Interpreter::Execute(
 			}
 			else if (returnable->Type() == NodeType::CALL)
 			{
-				*returned = _ExecuteFunction(static_cast<FunctionCall*>(returnable), currentScope);
-				(*returned)->MarkDelete(true);
+				FunctionCall* call   = static_cast<FunctionCall*>(returnable);
+				Node*         callee = (call->TailCall()) ?
+					currentScope.Search(static_cast<IdentifierNode*>(call->Identifier())->Value()) :
+					nullptr;
+
+				// Calls in tail position only have their arguments
+				// evaluated here, and are handed back to the frame
+				// running this function to be ran in its place
+				if (
+					function &&
+					callee &&
+					callee->Type() == NodeType::FUNCTION &&
+					callee != call->InlinedDeclaration() &&
+					static_cast<FunctionDeclaration*>(callee)->Arguments().size() == call->Arguments().size()
+				)
+				{
+					FunctionDeclaration* declaration = static_cast<FunctionDeclaration*>(callee);
+
+					// Evaluated into a scope of its own first, as the
+					// arguments may run tail calls of their own
+					Scope arguments = { 0 };
+
+					_InsertArguments(declaration, call, currentScope, arguments);
+
+					m_tailArguments.variables.swap(arguments.variables);
+					m_tailCall = declaration;
+
+					*returned = declaration;
+				}
+				else
+				{
+					*returned = _ExecuteFunction(call, currentScope);
+					(*returned)->MarkDelete(true);
+				}
 			}
 			else if (returnable->Type() == NodeType::ARRAY)
 				*returned = returnable->Clone();
+			else if (returnable->Type() == NodeType::MAP)
+			{
+				*returned = _EvaluateMap(static_cast<MapNode*>(returnable), currentScope);
+				(*returned)->MarkDelete(true);
+			}
 			else if (returnable->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 			{
-				*returned = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(returnable), currentScope)->Clone();
+				*returned = m_constants.Share(_GetArrayElement(static_cast<ArrayElementIdentifierNode*>(returnable), currentScope));
+				(*returned)->MarkDelete(true);
+			}
+			else if (returnable->Type() == NodeType::MEMBER_IDENTIFIER)
+			{
+				*returned = m_constants.Share(_GetMember(static_cast<MemberIdentifierNode*>(returnable), currentScope));
 				(*returned)->MarkDelete(true);
 			}
 
@@ -256,6 +539,8 @@ void Interpreter::Execute(
 			break;
 		}
 	}
+
+	_ReleaseLoaded(loaded);
 }
 
 void Interpreter::_ExecuteAssign(
@@ -284,11 +569,24 @@ void Interpreter::_ExecuteAssign(
 	// to the scope map
 	//Node* find = scope.Search(identifier);
 
+	// Updating an integer or decimal with an operation
+	// on itself changes the value where it is held,
+	// without searching for it twice
+	if (assign->SelfUpdate() && _ExecuteSelfUpdate(assign, scope))
+		return;
+
+	// Appending to a string can grow the string held
+	// by the identifier, instead of copying the whole
+	// string into a new one for every append
+	if (_ExecuteStringAppend(assign, scope))
+		return;
+
 	Node* value = nullptr;
 
 	// Check if the assigned value is a singular
-	// type, and if so, just set it to a copy
-	// of that node
+	// type, and if so, just set it to the shared
+	// constant for it, or a copy of the node if
+	// there isn't one
 	//
 	// A binary operation will have the value set
 	// to the result of the operation
@@ -296,14 +594,13 @@ void Interpreter::_ExecuteAssign(
 	// Function declarations are stored as the same
 	// node from the AST, thus, if deleting a global
 	// node, check if it is not a function declaration first
-	if (assign->GetAssignment()->Type() == NodeType::INTEGER)
-		value = static_cast<IntegerNode*>(assign->GetAssignment())->Clone();
-	else if (assign->GetAssignment()->Type() == NodeType::DECIMAL)
-		value = static_cast<DecimalNode*>(assign->GetAssignment())->Clone();
-	else if (assign->GetAssignment()->Type() == NodeType::STRING)
-		value = static_cast<StringNode*>(assign->GetAssignment())->Clone();
-	else if (assign->GetAssignment()->Type() == NodeType::BOOLEAN)
-		value = static_cast<BooleanNode*>(assign->GetAssignment())->Clone();
+	if (
+		assign->GetAssignment()->Type() == NodeType::INTEGER ||
+		assign->GetAssignment()->Type() == NodeType::DECIMAL ||
+		assign->GetAssignment()->Type() == NodeType::STRING  ||
+		assign->GetAssignment()->Type() == NodeType::BOOLEAN
+	)
+		value = m_constants.Literal(assign->GetAssignment());
 	else if (assign->GetAssignment()->Type() == NodeType::BINARY_OP)
 		value = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(assign->GetAssignment()), scope);
 	else if (assign->GetAssignment()->Type() == NodeType::LOGICAL_OP)
@@ -311,7 +608,21 @@ void Interpreter::_ExecuteAssign(
 	else if (assign->GetAssignment()->Type() == NodeType::CALL)
 		value = _ExecuteFunction(static_cast<FunctionCall*>(assign->GetAssignment()), scope);
 	else if (assign->GetAssignment()->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
-		value = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(assign->GetAssignment()), scope)->Clone();
+		value = m_constants.Share(_GetArrayElement(static_cast<ArrayElementIdentifierNode*>(assign->GetAssignment()), scope));
+	else if (assign->GetAssignment()->Type() == NodeType::MEMBER_IDENTIFIER)
+		value = m_constants.Share(_GetMember(static_cast<MemberIdentifierNode*>(assign->GetAssignment()), scope));
+	else if (assign->GetAssignment()->Type() == NodeType::MAP)
+		value = _EvaluateMap(static_cast<MapNode*>(assign->GetAssignment()), scope);
+	// Copying another variable only copies the value, so
+	// strings and arrays share their contents until either
+	// of them is changed
+	else if (assign->GetAssignment()->Type() == NodeType::IDENTIFIER)
+	{
+		Node* found = scope.Search(static_cast<IdentifierNode*>(assign->GetAssignment())->Value());
+
+		if (found && !IsDeclaration(found))
+			value = m_constants.Share(found);
+	}
 
 	if (!value)
 	{
@@ -328,9 +639,39 @@ void Interpreter::_ExecuteAssign(
 
 	// If this is just a plain identifier, just
 	// insert into the scope, otherwise, try
-	// and set an element in an array
+	// and set an element in an array, or a
+	// field of a struct
 	if (assign->GetIdentifier()->Type() == NodeType::IDENTIFIER)
 		scope.Insert(identifier, value);
+	else if (assign->GetIdentifier()->Type() == NodeType::MEMBER_IDENTIFIER)
+	{
+		MemberIdentifierNode* member = static_cast<MemberIdentifierNode*>(assign->GetIdentifier());
+		StructNode*           object = _GetMemberObject(member, scope);
+
+		if (!object || !value)
+		{
+			ReleaseNode(value);
+
+			return;
+		}
+
+		size_t slot = member->Slot(object->Declaration());
+
+		if (slot >= object->Declaration()->Fields())
+		{
+			std::cerr << "Interpreter Error! Struct \"" << static_cast<IdentifierNode*>(object->Declaration()->Identifier())->Value();
+			std::cerr << "\" has no field \"" << member->Member() << "\" to assign to!" << std::endl;
+
+			ReleaseNode(value);
+
+			if (m_errorHandle)
+				m_errorHandle();
+
+			return;
+		}
+
+		object->Slot(slot, value);
+	}
 	else if (assign->GetIdentifier()->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 	{
 		Node* arrayNode = scope.Search(identifier);
@@ -343,6 +684,92 @@ void Interpreter::_ExecuteAssign(
 				m_errorHandle();
 		}
 
+		ArrayElementIdentifierNode* element = static_cast<ArrayElementIdentifierNode*>(assign->GetIdentifier());
+
+		// Indices proven to be within bounds are always an
+		// integer variable, so skip evaluating and checking it
+		if (element->InBounds() && arrayNode && arrayNode->Type() == NodeType::ARRAY)
+		{
+			IntegerNode* index = static_cast<IntegerNode*>(scope.Search(static_cast<IdentifierNode*>(element->Index())->Value()));
+
+			static_cast<ArrayNode*>(arrayNode)->Set(index->Value(), value);
+
+			return;
+		}
+
+		// Elements of a matrix are always decimals,
+		// so integers are converted when assigned
+		if (arrayNode && arrayNode->Type() == NodeType::MATRIX)
+		{
+			MatrixNode* matrix = static_cast<MatrixNode*>(arrayNode);
+			size_t      offset = 0;
+
+			bool valid = _GetMatrixOffset(
+				matrix,
+				static_cast<ArrayElementIdentifierNode*>(assign->GetIdentifier()),
+				scope,
+				offset
+			);
+
+			if (valid && value && (value->Type() == NodeType::INTEGER || value->Type() == NodeType::DECIMAL))
+				matrix->MutableValues()[offset] = (value->Type() == NodeType::INTEGER) ?
+					static_cast<float>(static_cast<IntegerNode*>(value)->Value()) :
+					static_cast<DecimalNode*>(value)->Value();
+			else if (valid)
+			{
+				std::cerr << "Interpreter Error! Only integers or decimals can be assigned to an element of a matrix!" << std::endl;
+
+				if (value)
+					std::cerr << "Actual Type: " << GetNodeTypeName(value->Type()) << std::endl;
+
+				if (m_errorHandle)
+					m_errorHandle();
+			}
+
+			ReleaseNode(value);
+
+			return;
+		}
+
+		if (static_cast<ArrayElementIdentifierNode*>(assign->GetIdentifier())->Column())
+		{
+			std::cerr << "Interpreter Error! Only a matrix can be assigned to with both a row and a column!" << std::endl;
+
+			ReleaseNode(value);
+
+			if (m_errorHandle)
+				m_errorHandle();
+
+			return;
+		}
+
+		// Assigning to a key of a map either adds the
+		// key or replaces its value
+		if (arrayNode->Type() == NodeType::MAP)
+		{
+			Node* key = _EvaluateOwned(static_cast<ArrayElementIdentifierNode*>(assign->GetIdentifier())->Index(), scope);
+
+			if (!key || !MapNode::Hashable(key))
+			{
+				std::cerr << "Interpreter Error! Key for map element assignment must be an integer, decimal, string, or boolean!" << std::endl;
+
+				if (key)
+					std::cerr << "Actual Type: " << GetNodeTypeName(key->Type()) << std::endl;
+
+				ReleaseNode(key);
+				ReleaseNode(value);
+
+				if (m_errorHandle)
+					m_errorHandle();
+
+				return;
+			}
+
+			static_cast<MapNode*>(arrayNode)->Set(key, value);
+
+			return;
+		}
+
 		if (arrayNode->Type() != NodeType::ARRAY)
 		{
 			std::cerr << "Interpreter Error! Cannot assign to a array element with a non-array type!" << std::endl;
@@ -352,18 +779,7 @@ void Interpreter::_ExecuteAssign(
 		// Grab the array index
 		// Now, evaluate the index used
 		// for the identifier
-		Node* index = static_cast<ArrayElementIdentifierNode*>(assign->GetIdentifier())->Index()->Clone();
-
-		if (index->Type() == NodeType::IDENTIFIER)
-			index = scope.Search(static_cast<IdentifierNode*>(index)->Value())->Clone();
-		else if (index->Type() == NodeType::BINARY_OP)
-			index = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(index), scope);
-		else if (index->Type() == NodeType::LOGICAL_OP)
-			index = _ExecuteLogicalOperation(static_cast<BinaryOperation*>(index), scope);
-		else if (index->Type() == NodeType::CALL)
-			index = _ExecuteFunction(static_cast<FunctionCall*>(index), scope);
-		else if (index->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
-			index = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(index), scope)->Clone();
+		Node* index = _EvaluateOwned(element->Index(), scope);
 
 		if (!index)
 		{
@@ -378,7 +794,7 @@ void Interpreter::_ExecuteAssign(
 			std::cerr << "Interpreter Error! Index for array element assignment must be an integer!" << std::endl;
 			std::cerr << "Actual Type: " << GetNodeTypeName(index->Type());
 
-			delete index;
+			ReleaseNode(index);
 
 			if (m_errorHandle)
 				m_errorHandle();
@@ -388,7 +804,7 @@ void Interpreter::_ExecuteAssign(
 		int32_t arrIndex = static_cast<IntegerNode*>(index)->Value();
 
 		// The index node is no longer needed, delete
-		delete index;
+		ReleaseNode(index);
 
 		// Check if the index would be out of bounds
 		if (arrIndex < 0 || static_cast<size_t>(arrIndex) >= static_cast<ArrayNode*>(arrayNode)->Size())
@@ -405,38 +821,253 @@ void Interpreter::_ExecuteAssign(
 	}
 }
 
-void Interpreter::_ExecuteIfStatement(
-	IfStatement* statement,
-	bool         function,
-	Node**       returnNode,
-	Scope&       scope
+bool Interpreter::_ExecuteSelfUpdate(
+	AssignmentNode* assign,
+	Scope&          scope
 )
 {
-	// First, try and evaluate the condition
-	Node* condition = statement->Condition();
+	BinaryOperation* operation = static_cast<BinaryOperation*>(assign->GetAssignment());
 
-	if (condition->Type() == NodeType::IDENTIFIER)
-		condition = scope.Search(static_cast<IdentifierNode*>(condition)->Value());
-	else if (condition->Type() == NodeType::CALL)
-		condition = _ExecuteFunction(static_cast<FunctionCall*>(condition), scope);
-	else if (condition->Type() == NodeType::BINARY_OP)
-		condition = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(condition), scope);
-	else if (condition->Type() == NodeType::LOGICAL_OP)
-		condition = _ExecuteLogicalOperation(static_cast<BinaryOperation*>(condition), scope);
-	else if (condition->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
-		condition = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(condition), scope);
+	if (operation->HoistedLoop())
+		return false;
 
-	// Make sure that the condition is a boolean value
-	// otherwise, you can't exactly "evaluate" the statement
-	if (condition->Type() != NodeType::BOOLEAN)
+	Node** slot = scope.Slot(static_cast<IdentifierNode*>(assign->GetIdentifier())->Value());
+
+	if (
+		!slot  ||
+		!*slot ||
+		((*slot)->Type() != NodeType::INTEGER && (*slot)->Type() != NodeType::DECIMAL)
+	)
+		return false;
+
+	// Only a right hand which can be read without running
+	// anything is used, so falling back to the regular
+	// path never runs any part of the operation twice
+	Node*    rightHand = operation->GetRightHand();
+	NodeType type      = NodeType::ROOT;
+	int32_t  integer   = 0;
+	float    decimal   = 0.0f;
+
+	if (rightHand->Type() == NodeType::IDENTIFIER)
+		rightHand = scope.Search(static_cast<IdentifierNode*>(rightHand)->Value());
+	else if (rightHand->Type() == NodeType::BINARY_OP)
 	{
-		std::cerr << "Interpreter Error! If statement's condition must be of a boolean return!" << std::endl;
-		std::cerr << "Current condition type: " << GetNodeTypeName(condition->Type()) << std::endl;
+		BinaryOperation* nested = static_cast<BinaryOperation*>(rightHand);
 
-		if (m_errorHandle)
-			m_errorHandle();
+		if (!nested->Proven() || nested->HoistedLoop())
+			return false;
 
-		return;
+		if (nested->ProvenType() == NodeType::INTEGER && _EvaluateInteger(nested, scope, integer))
+			type = NodeType::INTEGER;
+		else if (nested->ProvenType() == NodeType::DECIMAL && _EvaluateDecimal(nested, scope, decimal))
+			type = NodeType::DECIMAL;
+		else
+			return false;
+
+		rightHand = nullptr;
+	}
+
+	if (rightHand && rightHand->Type() == NodeType::INTEGER)
+	{
+		integer = static_cast<IntegerNode*>(rightHand)->Value();
+		type    = NodeType::INTEGER;
+	}
+	else if (rightHand && rightHand->Type() == NodeType::DECIMAL)
+	{
+		decimal = static_cast<DecimalNode*>(rightHand)->Value();
+		type    = NodeType::DECIMAL;
+	}
+	else if (rightHand || type == NodeType::ROOT)
+		return false;
+
+	Node* current = *slot;
+
+	if (current->Type() == NodeType::INTEGER && type == NodeType::INTEGER)
+	{
+		int32_t value = 0;
+
+		if (!Arithmetic(operation->Operation(), static_cast<IntegerNode*>(current)->Value(), integer, value))
+			return false;
+
+		// Shared constants can never be changed, though
+		// they also never need to be released
+		if (current->Immortal())
+			*slot = m_constants.Integer(value);
+		else
+			static_cast<IntegerNode*>(current)->Value(false, value);
+
+		return true;
+	}
+
+	// Integers are converted the same as when an
+	// operation has a decimal on only one side
+	float leftHand = (current->Type() == NodeType::INTEGER) ?
+		static_cast<float>(static_cast<IntegerNode*>(current)->Value()) :
+		static_cast<DecimalNode*>(current)->Value();
+	float value    = 0.0f;
+
+	if (type == NodeType::INTEGER)
+		decimal = static_cast<float>(integer);
+
+	if (!Arithmetic(operation->Operation(), leftHand, decimal, value))
+		return false;
+
+	if (current->Type() == NodeType::DECIMAL)
+	{
+		static_cast<DecimalNode*>(current)->Value(false, value);
+
+		return true;
+	}
+
+	DecimalNode* result = new DecimalNode();
+	result->Type(NodeType::DECIMAL);
+	result->Value(false, value);
+
+	ReleaseNode(current);
+
+	*slot = result;
+
+	return true;
+}
+
+bool Interpreter::_ExecuteStringAppend(
+	AssignmentNode* assign,
+	Scope&          scope
+)
+{
+	// Only an addition with the assigned identifier on
+	// its left hand, such as "a += b" or "a = a + b", is
+	// an append
+	if (
+		assign->GetIdentifier()->Type() != NodeType::IDENTIFIER ||
+		assign->GetAssignment()->Type() != NodeType::BINARY_OP
+	)
+		return false;
+
+	BinaryOperation* operation = static_cast<BinaryOperation*>(assign->GetAssignment());
+
+	if (
+		operation->Operation() != NodeType::ADD ||
+		operation->GetLeftHand()->Type() != NodeType::IDENTIFIER
+	)
+		return false;
+
+	const std::string& identifier = static_cast<IdentifierNode*>(assign->GetIdentifier())->Value();
+
+	if (static_cast<IdentifierNode*>(operation->GetLeftHand())->Value() != identifier)
+		return false;
+
+	Node* current = scope.Search(identifier);
+
+	if (!current || current->Type() != NodeType::STRING)
+		return false;
+
+	// Evaluate the right hand before touching the current
+	// value, as a call could assign to the identifier
+	Node* rightHand = operation->GetRightHand();
+	bool  temporary = false;
+
+	if (rightHand->Type() == NodeType::IDENTIFIER)
+		rightHand = scope.Search(static_cast<IdentifierNode*>(rightHand)->Value());
+	else if (rightHand->Type() == NodeType::BINARY_OP)
+	{
+		rightHand = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(rightHand), scope);
+		temporary = true;
+	}
+	else if (rightHand->Type() == NodeType::LOGICAL_OP)
+	{
+		rightHand = _ExecuteLogicalOperation(static_cast<BinaryOperation*>(rightHand), scope);
+		temporary = true;
+	}
+	else if (rightHand->Type() == NodeType::CALL)
+	{
+		rightHand = _ExecuteFunction(static_cast<FunctionCall*>(rightHand), scope);
+		temporary = true;
+	}
+	else if (rightHand->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+		rightHand = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(rightHand), scope);
+	else if (rightHand->Type() == NodeType::MEMBER_IDENTIFIER)
+		rightHand = _GetMember(static_cast<MemberIdentifierNode*>(rightHand), scope);
+
+	current = scope.Search(identifier);
+
+	if (
+		!rightHand ||
+		!current   ||
+		rightHand->Type() != NodeType::STRING ||
+		current->Type()   != NodeType::STRING
+	)
+	{
+		std::cerr << "Interpreter Error! Mismatched type for operation." << std::endl;
+
+		if (current && rightHand)
+		{
+			std::cerr << "Left-hand type: " << GetNodeTypeName(current->Type()) << ";";
+			std::cerr << " Right-hand type: " << GetNodeTypeName(rightHand->Type()) << std::endl;
+		}
+
+		if (temporary)
+			ReleaseNode(rightHand);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return true;
+	}
+
+	// Shared constants can never be changed, so the first
+	// append to one creates a string owned by the scope,
+	// which every append after can then grow in place
+	if (current->Immortal())
+	{
+		StringNode* value = static_cast<StringNode*>(current->Clone());
+		value->Append(*static_cast<StringNode*>(rightHand));
+
+		scope.Insert(identifier, value);
+	}
+	else
+		static_cast<StringNode*>(current)->Append(*static_cast<StringNode*>(rightHand));
+
+	if (temporary)
+		ReleaseNode(rightHand);
+
+	return true;
+}
+
+void Interpreter::_ExecuteIfStatement(
+	IfStatement* statement,
+	bool         function,
+	Node**       returnNode,
+	Scope&       scope
+)
+{
+	// First, try and evaluate the condition
+	Node* condition = statement->Condition();
+
+	if (condition->Type() == NodeType::IDENTIFIER)
+		condition = scope.Search(static_cast<IdentifierNode*>(condition)->Value());
+	else if (condition->Type() == NodeType::CALL)
+		condition = _ExecuteFunction(static_cast<FunctionCall*>(condition), scope);
+	else if (condition->Type() == NodeType::BINARY_OP)
+		condition = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(condition), scope);
+	else if (condition->Type() == NodeType::LOGICAL_OP)
+		condition = _ExecuteLogicalOperation(static_cast<BinaryOperation*>(condition), scope);
+	else if (condition->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+		condition = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(condition), scope);
+	else if (condition->Type() == NodeType::MEMBER_IDENTIFIER)
+		condition = _GetMember(static_cast<MemberIdentifierNode*>(condition), scope);
+
+	// Make sure that the condition is a boolean value
+	// otherwise, you can't exactly "evaluate" the statement
+	if (condition->Type() != NodeType::BOOLEAN)
+	{
+		std::cerr << "Interpreter Error! If statement's condition must be of a boolean return!" << std::endl;
+		std::cerr << "Current condition type: " << GetNodeTypeName(condition->Type()) << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return;
 	}
 
 	bool ifCondition = static_cast<BooleanNode*>(condition)->Value();
@@ -489,6 +1120,34 @@ void Interpreter::_ExecuteWhileStatement(
 	Node**       returnNode,
 	Scope&       scope
 )
+{
+	if (statement->Hoisted() == 0)
+	{
+		_ExecuteWhileLoop(statement, function, returnNode, scope);
+
+		return;
+	}
+
+	// Each run of the loop evaluates its hoisted expressions
+	// again, and the loop may be ran again from within itself
+	// through a call, so keep the values of any outer run
+	std::vector<Node*>  values(statement->Hoisted(), nullptr);
+	std::vector<Node*>* previous = statement->HoistedValues(&values);
+
+	_ExecuteWhileLoop(statement, function, returnNode, scope);
+
+	statement->HoistedValues(previous);
+
+	for (size_t index = 0; index < values.size(); index++)
+		ReleaseNode(values[index]);
+}
+
+void Interpreter::_ExecuteWhileLoop(
+	WhileStatement* statement,
+	bool         function,
+	Node**       returnNode,
+	Scope&       scope
+)
 {
 	// First, try and evaluate the condition
 	Node* condition = statement->Condition();
@@ -501,6 +1160,8 @@ void Interpreter::_ExecuteWhileStatement(
 		condition = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(condition), scope);
 	else if (condition->Type() == NodeType::LOGICAL_OP)
 		condition = _ExecuteLogicalOperation(static_cast<BinaryOperation*>(condition), scope);
+	else if (condition->Type() == NodeType::MEMBER_IDENTIFIER)
+		condition = _GetMember(static_cast<MemberIdentifierNode*>(condition), scope);
 
 	// Make sure that the condition is a boolean value
 	// otherwise, you can't exactly "evaluate" the statement
@@ -520,10 +1181,16 @@ void Interpreter::_ExecuteWhileStatement(
 	Scope whileScope  = { 0 };
 	whileScope.parent = &scope;
 
+	// Values loaded while evaluating the condition
+	// are only needed for a single iteration
+	const size_t loaded = m_loaded.size();
+
 	// Now, for the while loop, while the condition evaluates to
 	// false, execute and then subsequently re-evaluate
 	while (static_cast<BooleanNode*>(condition)->Value())
 	{
+		_ReleaseLoaded(loaded);
+
 		Execute(
 			static_cast<RootNode*>(statement->Body()),
 			function,
@@ -531,6 +1198,9 @@ void Interpreter::_ExecuteWhileStatement(
 			&whileScope
 		);
 
+		if ((function && *returnNode) || _StopLoop())
+			break;
+
 		// Re-evaluate using the same code as used above
 		// First, try and evaluate the condition
 		condition = statement->Condition();
@@ -543,6 +1213,8 @@ void Interpreter::_ExecuteWhileStatement(
 			condition = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(condition), scope);
 		else if (condition->Type() == NodeType::LOGICAL_OP)
 			condition = _ExecuteLogicalOperation(static_cast<BinaryOperation*>(condition), scope);
+		else if (condition->Type() == NodeType::MEMBER_IDENTIFIER)
+			condition = _GetMember(static_cast<MemberIdentifierNode*>(condition), scope);
 
 		// Make sure that the condition is a boolean value
 		// otherwise, you can't exactly "evaluate" the statement
@@ -559,6 +1231,196 @@ void Interpreter::_ExecuteWhileStatement(
 	}
 }
 
+void Interpreter::_ExecuteForStatement(
+	ForStatement* statement,
+	bool          function,
+	Node**        returnNode,
+	Scope&        scope
+)
+{
+	if (statement->IsRange())
+		_ExecuteForRange(statement, function, returnNode, scope);
+	else
+		_ExecuteForEach(statement, function, returnNode, scope);
+}
+
+void Interpreter::_ExecuteForRange(
+	ForStatement* statement,
+	bool          function,
+	Node**        returnNode,
+	Scope&        scope
+)
+{
+	// Both ends of the range are only evaluated
+	// once, before the first iteration
+	Node* start = _EvaluateOwned(statement->Start(), scope);
+	Node* end   = _EvaluateOwned(statement->End(), scope);
+
+	if (
+		!start || !end ||
+		start->Type() != NodeType::INTEGER ||
+		end->Type()   != NodeType::INTEGER
+	)
+	{
+		std::cerr << "Interpreter Error! The start and end of a range must be integers!" << std::endl;
+
+		if (start && end)
+		{
+			std::cerr << "Start type: " << GetNodeTypeName(start->Type()) << ";";
+			std::cerr << " End type: " << GetNodeTypeName(end->Type()) << std::endl;
+		}
+
+		ReleaseNode(start);
+		ReleaseNode(end);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return;
+	}
+
+	const int32_t first = static_cast<IntegerNode*>(start)->Value();
+	const int32_t last  = static_cast<IntegerNode*>(end)->Value();
+
+	ReleaseNode(start);
+	ReleaseNode(end);
+
+	if (first >= last)
+		return;
+
+	// The variable is owned by the scope of the loop,
+	// and can't be assigned to within the body, so the
+	// same integer is changed for each iteration
+	Scope forScope  = { 0 };
+	forScope.parent = &scope;
+
+	IntegerNode* counter = new IntegerNode();
+	counter->Type(NodeType::INTEGER);
+	counter->MarkDelete(true);
+
+	forScope.variables[static_cast<IdentifierNode*>(statement->Identifier())->Value()] = counter;
+
+	const size_t loaded = m_loaded.size();
+
+	for (int32_t index = first; index < last; index++)
+	{
+		_ReleaseLoaded(loaded);
+
+		counter->Value(false, index);
+
+		Execute(
+			static_cast<RootNode*>(statement->Body()),
+			function,
+			returnNode,
+			&forScope
+		);
+
+		if ((function && *returnNode) || _StopLoop())
+			break;
+	}
+}
+
+void Interpreter::_ExecuteForEach(
+	ForStatement* statement,
+	bool          function,
+	Node**        returnNode,
+	Scope&        scope
+)
+{
+	// Copies of an array share its elements until either
+	// is changed, so this only copies them if the body
+	// changes the array being gone through
+	Node* iterable = _EvaluateOwned(statement->Iterable(), scope);
+
+	if (!iterable || iterable->Type() != NodeType::ARRAY)
+	{
+		std::cerr << "Interpreter Error! A for loop can only go through the elements of an array!" << std::endl;
+
+		if (iterable)
+			std::cerr << "Actual Type: " << GetNodeTypeName(iterable->Type()) << std::endl;
+
+		ReleaseNode(iterable);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return;
+	}
+
+	ArrayNode* array = static_cast<ArrayNode*>(iterable);
+
+	Scope forScope  = { 0 };
+	forScope.parent = &scope;
+
+	Node*& variable = forScope.variables[static_cast<IdentifierNode*>(statement->Identifier())->Value()];
+
+	// Packed integers and decimals are given to the body
+	// through a single value changed for each iteration
+	Node* packed = nullptr;
+
+	if (array->Storage() == ArrayStorage::INTEGER)
+	{
+		packed = new IntegerNode();
+		packed->Type(NodeType::INTEGER);
+	}
+	else if (array->Storage() == ArrayStorage::DECIMAL)
+	{
+		packed = new DecimalNode();
+		packed->Type(NodeType::DECIMAL);
+	}
+
+	if (packed)
+		packed->MarkDelete(true);
+
+	variable = packed;
+
+	const size_t loaded = m_loaded.size();
+	const size_t size   = array->Size();
+
+	for (size_t index = 0; index < size; index++)
+	{
+		_ReleaseLoaded(loaded);
+
+		switch (array->Storage())
+		{
+		case ArrayStorage::INTEGER:
+			static_cast<IntegerNode*>(packed)->Value(false, array->Integers()[index]);
+			break;
+		case ArrayStorage::DECIMAL:
+			static_cast<DecimalNode*>(packed)->Value(false, array->Decimals()[index]);
+			break;
+		case ArrayStorage::BOOLEAN:
+			variable = m_constants.Boolean(array->Booleans()[index] != 0);
+			break;
+		default:
+			// Boxed elements are copied the same as when
+			// assigning an element to a variable
+			ReleaseNode(variable);
+
+			variable = m_constants.Share((*array)[index]);
+			variable->MarkDelete(true);
+
+			break;
+		}
+
+		Execute(
+			static_cast<RootNode*>(statement->Body()),
+			function,
+			returnNode,
+			&forScope
+		);
+
+		if ((function && *returnNode) || _StopLoop())
+			break;
+	}
+
+	// Empty arrays never gave the variable a value
+	if (!variable)
+		forScope.variables.clear();
+
+	ReleaseNode(array);
+}
+
 void Interpreter::_ExecuteFunctionDeclaration(FunctionDeclaration* declaration)
 {
 	// Grab the identifier string for getting (or adding)
@@ -568,6 +1430,16 @@ void Interpreter::_ExecuteFunctionDeclaration(FunctionDeclaration* declaration)
 	m_globalScope.Insert(identifier, declaration);
 }
 
+void Interpreter::_ExecuteStructDeclaration(StructDeclaration* declaration)
+{
+	// Structs are stored in global scope the same
+	// as functions, so they can be instantiated
+	// from anywhere
+	const std::string identifier = static_cast<IdentifierNode*>(declaration->Identifier())->Value();
+
+	m_globalScope.Insert(identifier, declaration);
+}
+
 void Interpreter::_ExecuteArrayDeclaration(
 	AST::AssignmentNode* arrayAssignment,
 	Scope&               scope
@@ -580,7 +1452,22 @@ void Interpreter::_ExecuteArrayDeclaration(
 	// Grab the ArrayNode to be taken from
 	ArrayNode* arrayNode = static_cast<ArrayNode*>(arrayAssignment->GetAssignment());
 
-	// Also, create a new array node to store
+	ArrayNode* finalArray = _EvaluateArray(arrayNode, identifier, scope);
+
+	if (!finalArray)
+		return;
+
+	// Insert into the scope
+	scope.Insert(identifier, finalArray);
+}
+
+ArrayNode* Interpreter::_EvaluateArray(
+	ArrayNode*         arrayNode,
+	const std::string& identifier,
+	Scope&             scope
+)
+{
+	// Create a new array node to store
 	// all of the evaluated portions of the
 	// declaration
 	ArrayNode* finalArray = new ArrayNode();
@@ -593,10 +1480,14 @@ void Interpreter::_ExecuteArrayDeclaration(
 	{
 		Node* capacity = arrayNode->Capacity();
 
-		if (capacity->Type() == NodeType::IDENTIFIER)
-			capacity = scope.Search(static_cast<IdentifierNode*>(capacity)->Value())->Clone();
+		if (capacity->Type() == NodeType::INTEGER)
+			capacity = m_constants.Literal(capacity);
+		else if (capacity->Type() == NodeType::IDENTIFIER)
+			capacity = m_constants.Share(scope.Search(static_cast<IdentifierNode*>(capacity)->Value()));
 		else if (capacity->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
-			capacity = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(capacity), scope)->Clone();
+			capacity = m_constants.Share(_GetArrayElement(static_cast<ArrayElementIdentifierNode*>(capacity), scope));
+		else if (capacity->Type() == NodeType::MEMBER_IDENTIFIER)
+			capacity = m_constants.Share(_GetMember(static_cast<MemberIdentifierNode*>(capacity), scope));
 		else if (capacity->Type() == NodeType::BINARY_OP)
 			capacity = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(capacity), scope);
 		else if (capacity->Type() == NodeType::LOGICAL_OP)
@@ -605,25 +1496,56 @@ void Interpreter::_ExecuteArrayDeclaration(
 			capacity = _ExecuteFunction(static_cast<FunctionCall*>(capacity), scope);
 	
 		// Make sure that the capacity is an integer
-		if (!capacity || capacity->Type() != NodeType::INTEGER)
+		if (!capacity || capacity->Type() != NodeType::INTEGER || static_cast<IntegerNode*>(capacity)->Value() < 0)
 		{
-			std::cerr << "Interpreter Error! Fixed-array capacity must be an integer!" << std::endl;
+			std::cerr << "Interpreter Error! Fixed-array capacity must be a positive integer!" << std::endl;
 			
 			if (capacity)
 				std::cerr << "Actual Type: " << GetNodeTypeName(capacity->Type()) << std::endl;
 		
+			ReleaseNode(capacity);
+
 			delete finalArray;
 
 			if (m_errorHandle)
 				m_errorHandle();
+
+			return nullptr;
 		}
 
-		finalArray->Fixed(true);
-		finalArray->Capacity(capacity);
-	}
+		size_t limit = static_cast<size_t>(static_cast<IntegerNode*>(capacity)->Value());
 
-	// Now, if there are elements, iterate through
-	for (size_t index = 0; index < arrayNode->Size(); index++)
+		// The elements can be checked against the
+		// capacity before evaluating any of them
+		if (arrayNode->Size() > limit)
+		{
+			std::cerr << "Interpreter Error! Element count in array definition, \"" << identifier << "\" is over the fixed capacity!" << std::endl;
+			std::cerr << "Element count: " << arrayNode->Size() << "; Capacity: " << limit << std::endl;
+
+			ReleaseNode(capacity);
+
+			delete finalArray;
+
+			if (m_errorHandle)
+				m_errorHandle();
+
+			return nullptr;
+		}
+
+		finalArray->Fixed(true);
+		finalArray->Capacity(capacity);
+
+		// Allocate the whole capacity up front, so
+		// the array never grows afterwards
+		finalArray->Limit(limit);
+	}
+	else
+		finalArray->Reserve(arrayNode->Size());
+
+	finalArray->Packable(true);
+
+	// Now, if there are elements, iterate through
+	for (size_t index = 0; index < arrayNode->Size(); index++)
 	{
 		Node* element = (*arrayNode)[index];
 
@@ -631,16 +1553,16 @@ void Interpreter::_ExecuteArrayDeclaration(
 		// For an identifier, search
 		// through the scope and convert
 		if (element->Type() == NodeType::IDENTIFIER)
-			element = scope.Search(static_cast<IdentifierNode*>(element)->Value())->Clone();
-		// For any singluar type, clone
-		// and store
+			element = m_constants.Share(scope.Search(static_cast<IdentifierNode*>(element)->Value()));
+		// For any singluar type, use the shared
+		// constant for it if there is one
 		else if (
 			element->Type() == NodeType::INTEGER ||
 			element->Type() == NodeType::DECIMAL ||
 			element->Type() == NodeType::STRING ||
 			element->Type() == NodeType::BOOLEAN
 		)
-			element = element->Clone();
+			element = m_constants.Literal(element);
 		else if (element->Type() == NodeType::BINARY_OP)
 			element = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(element), scope);
 		else if (element->Type() == NodeType::LOGICAL_OP)
@@ -648,29 +1570,15 @@ void Interpreter::_ExecuteArrayDeclaration(
 		else if (element->Type() == NodeType::CALL)
 			element = _ExecuteFunction(static_cast<FunctionCall*>(element), scope);
 		else if (element->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
-			element = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(element), scope)->Clone();
+			element = m_constants.Share(_GetArrayElement(static_cast<ArrayElementIdentifierNode*>(element), scope));
+		else if (element->Type() == NodeType::MEMBER_IDENTIFIER)
+			element = m_constants.Share(_GetMember(static_cast<MemberIdentifierNode*>(element), scope));
 
 		// Now we can push the element to the array
 		finalArray->Insert(element);
-
-		// Make sure that we are not going over the
-		// capacity
-		int32_t capacityVal = static_cast<IntegerNode*>(finalArray->Capacity())->Value();
-
-		if (finalArray->Size() > static_cast<size_t>(capacityVal))
-		{
-			std::cerr << "Interpreter Error! Element count in array definition, \"" << identifier << "\" is over the fixed capacity!" << std::endl;
-			std::cerr << "Element count: " << finalArray->Size() << "; Capacity: " << capacityVal << std::endl;
-
-			delete finalArray;
-
-			if (m_errorHandle)
-				m_errorHandle();
-		}
 	}
 
-	// Insert into the scope
-	scope.Insert(identifier, finalArray);
+	return finalArray;
 }
 
 Node* Interpreter::_ExecuteFunction(
@@ -678,6 +1586,9 @@ Node* Interpreter::_ExecuteFunction(
 	Scope&        scope
 )
 {
+	if (call->HoistedLoop())
+		return _ExecuteHoisted(call, scope);
+
 	// If this is a print call, run it as such
 	// and return a nullptr (print returns nothing)
 	if (call->Flags() == CallFlags::PRINT)
@@ -729,12 +1640,128 @@ Node* Interpreter::_ExecuteFunction(
 			call,
 			scope
 		);
+	else if (
+		call->Flags() == CallFlags::SUBSTRING ||
+		call->Flags() == CallFlags::SLICE
+	)
+		return _ExecuteSubstring(
+			call,
+			scope
+		);
+	else if (call->Flags() == CallFlags::SPLIT)
+		return _ExecuteSplit(
+			call,
+			scope
+		);
+	else if (call->Flags() == CallFlags::JOIN)
+		return _ExecuteJoin(
+			call,
+			scope
+		);
+	else if (
+		call->Flags() == CallFlags::SUM     ||
+		call->Flags() == CallFlags::MINIMUM ||
+		call->Flags() == CallFlags::MAXIMUM
+	)
+		return _ExecuteArrayReduction(
+			call,
+			scope
+		);
+	else if (
+		call->Flags() == CallFlags::DOT   ||
+		call->Flags() == CallFlags::SCALE ||
+		call->Flags() == CallFlags::ADD_EACH
+	)
+		return _ExecuteArrayCombination(
+			call,
+			scope
+		);
+	else if (call->Flags() == CallFlags::COUNT)
+		return _ExecuteCount(
+			call,
+			scope
+		);
+	else if (
+		call->Flags() == CallFlags::HAS_KEY ||
+		call->Flags() == CallFlags::KEYS
+	)
+		return _ExecuteMapQuery(
+			call,
+			scope
+		);
+	else if (
+		call->Flags() == CallFlags::SORT ||
+		call->Flags() == CallFlags::SORT_DESCENDING
+	)
+		return _ExecuteSort(
+			call,
+			scope
+		);
+	else if (
+		call->Flags() == CallFlags::INDEX_OF      ||
+		call->Flags() == CallFlags::BINARY_SEARCH ||
+		call->Flags() == CallFlags::LOWER_BOUND
+	)
+		return _ExecuteSearch(
+			call,
+			scope
+		);
+	else if (call->Flags() == CallFlags::MATRIX)
+		return _ExecuteMatrix(
+			call,
+			scope
+		);
+	else if (
+		call->Flags() == CallFlags::MATRIX_MULTIPLY ||
+		call->Flags() == CallFlags::TRANSPOSE       ||
+		call->Flags() == CallFlags::ROW_SUMS        ||
+		call->Flags() == CallFlags::COLUMN_SUMS     ||
+		call->Flags() == CallFlags::ROWS            ||
+		call->Flags() == CallFlags::COLUMNS
+	)
+		return _ExecuteMatrixOperation(
+			call,
+			scope
+		);
+
+	// Calls on a member of a struct are
+	// to one of its member functions
+	if (call->Identifier()->Type() == NodeType::MEMBER_IDENTIFIER)
+		return _ExecuteMethod(
+			call,
+			scope
+		);
 
 	// First, try and find the actual function
 	// declaration in the global map
-	FunctionDeclaration* declaration = static_cast<FunctionDeclaration*>(scope.Search(static_cast<IdentifierNode*>(call->Identifier())->Value()));
+	Node* callee = scope.Search(static_cast<IdentifierNode*>(call->Identifier())->Value());
 
-	if (declaration->Arguments().size() != call->Arguments().size())
+	// Inlined calls only evaluate the function's expression
+	// in place, as long as the function called is still the
+	// one that was inlined
+	if (call->Inlined() && callee == call->InlinedDeclaration())
+	{
+		Node* value = _EvaluateOwned(call->Inlined(), scope);
+
+		if (value)
+			value->MarkDelete(true);
+
+		return value;
+	}
+
+	// Calling a struct creates a new instance of it
+	if (callee && callee->Type() == NodeType::STRUCT_DECLARATION)
+		return _ExecuteStructInstance(
+			static_cast<StructDeclaration*>(callee),
+			call,
+			scope
+		);
+
+	FunctionDeclaration* declaration = static_cast<FunctionDeclaration*>(callee);
+
+	// Calls to functions only declared once are checked
+	// before execution, so only check the others here
+	if (!call->ArgumentsChecked() && declaration->Arguments().size() != call->Arguments().size())
 	{
 		std::cerr << "Interpreter Error! Mismatched argument sizes!" << std::endl;
 		std::cerr << "Expected: " << declaration->Arguments().size() << "; Got: " << call->Arguments().size() << "!" << std::endl;
@@ -750,6 +1777,204 @@ Node* Interpreter::_ExecuteFunction(
 	Scope functionScope  = { 0 };
 	functionScope.parent = &m_globalScope;
 
+	_InsertArguments(declaration, call, scope, functionScope);
+
+	// A pure function always returns the same value for the
+	// same arguments, so it only has to be ran for each once
+	std::string key;
+
+	if (m_memoize && declaration->Pure() && _MemoKey(declaration, functionScope, key))
+	{
+		MemoTable& memo   = m_memos[declaration];
+		Node*      cached = memo.Find(key);
+
+		if (cached)
+		{
+			Node* value = m_constants.Share(cached);
+			value->MarkDelete(true);
+
+			return value;
+		}
+
+		Node* returnNode = _ExecuteBody(declaration, functionScope);
+
+		if (
+			returnNode &&
+			(returnNode->Type() == NodeType::INTEGER ||
+			 returnNode->Type() == NodeType::DECIMAL ||
+			 returnNode->Type() == NodeType::STRING  ||
+			 returnNode->Type() == NodeType::BOOLEAN)
+		)
+			memo.Insert(key, m_constants.Share(returnNode));
+
+		return returnNode;
+	}
+
+	// Now that we have all of the arguments, execute the function
+	// with the current arguments
+	return _ExecuteBody(declaration, functionScope);
+}
+
+bool Interpreter::_MemoKey(
+	FunctionDeclaration* declaration,
+	Scope&               functionScope,
+	std::string&         key
+)
+{
+	for (size_t index = 0; index < declaration->Arguments().size(); index++)
+	{
+		auto find = functionScope.variables.find(static_cast<IdentifierNode*>(declaration->Arguments()[index])->Value());
+
+		if (find == functionScope.variables.end() || !find->second)
+			return false;
+
+		Node* argument = find->second;
+
+		// Each value is kept as its type followed by its
+		// bytes, so values of different types never match
+		key.push_back(static_cast<char>(argument->Type()));
+
+		if (argument->Type() == NodeType::INTEGER)
+		{
+			int32_t value = static_cast<IntegerNode*>(argument)->Value();
+
+			key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+		else if (argument->Type() == NodeType::DECIMAL)
+		{
+			float value = static_cast<DecimalNode*>(argument)->Value();
+
+			key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+		}
+		else if (argument->Type() == NodeType::BOOLEAN)
+			key.push_back(static_cast<BooleanNode*>(argument)->Value() ? 1 : 0);
+		else if (argument->Type() == NodeType::STRING)
+		{
+			StringNode* value  = static_cast<StringNode*>(argument);
+			size_t      length = value->Length();
+
+			key.append(reinterpret_cast<const char*>(&length), sizeof(length));
+			key.append(value->Data(), length);
+		}
+		else
+			return false;
+	}
+
+	return true;
+}
+
+Node* Interpreter::_ExecuteBody(
+	FunctionDeclaration* declaration,
+	Scope&               functionScope
+)
+{
+	if (m_depth >= m_maxDepth)
+	{
+		std::cerr << "Interpreter Error! Calls nested deeper than the maximum depth of " << m_maxDepth << "!" << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	Node* returnNode = nullptr;
+
+	// Each call nests a few native frames, so once
+	// most of the stack is used the next calls are
+	// moved onto a new segment, before they can
+	// overflow the stack
+	char      top;
+	uintptr_t position = reinterpret_cast<uintptr_t>(&top);
+	size_t    used     = (position < m_stackBase) ? m_stackBase - position : position - m_stackBase;
+
+	if (used > m_stackUsage)
+	{
+		const uintptr_t base  = m_stackBase;
+		const size_t    usage = m_stackUsage;
+
+		bool ran = RunOnStackSegment(SEGMENT_STACK_SIZE, [&]() {
+			char segment;
+
+			m_stackBase  = reinterpret_cast<uintptr_t>(&segment);
+			m_stackUsage = SEGMENT_STACK_USE;
+
+			returnNode = _ExecuteFrame(declaration, functionScope);
+		});
+
+		m_stackBase  = base;
+		m_stackUsage = usage;
+
+		if (!ran)
+		{
+			std::cerr << "Interpreter Error! Could not create a stack for calls nested " << m_depth << " deep!" << std::endl;
+
+			if (m_errorHandle)
+				m_errorHandle();
+		}
+
+		return returnNode;
+	}
+
+	return _ExecuteFrame(declaration, functionScope);
+}
+
+Node* Interpreter::_ExecuteFrame(
+	FunctionDeclaration* declaration,
+	Scope&               functionScope
+)
+{
+	m_depth++;
+
+	// Values loaded by the statement returning a call
+	// are no longer needed once its arguments are in
+	const size_t loaded = m_loaded.size();
+
+	Node* returnNode = nullptr;
+
+	Execute(
+		static_cast<RootNode*>(declaration->Body()),
+		true,
+		&returnNode,
+		&functionScope
+	);
+
+	// Each call returned is ran within the same scope, with
+	// the arguments of the previous one swapped out for its
+	// own, so recursion through returns never nests
+	while (m_tailCall && returnNode == m_tailCall)
+	{
+		declaration = m_tailCall;
+		m_tailCall  = nullptr;
+
+		functionScope.Release();
+		functionScope.variables.swap(m_tailArguments.variables);
+		functionScope.receiver = nullptr;
+
+		_ReleaseLoaded(loaded);
+
+		returnNode = nullptr;
+
+		Execute(
+			static_cast<RootNode*>(declaration->Body()),
+			true,
+			&returnNode,
+			&functionScope
+		);
+	}
+
+	m_depth--;
+
+	return returnNode;
+}
+
+void Interpreter::_InsertArguments(
+	FunctionDeclaration* declaration,
+	FunctionCall*        call,
+	Scope&               scope,
+	Scope&               functionScope
+)
+{
 	// Now iterate through each argument within the call
 	// and the definition to create variables to add to
 	// the global map.
@@ -760,19 +1985,9 @@ Node* Interpreter::_ExecuteFunction(
 		Node* signature = declaration->Arguments()[index];
 		Node* argument  = call->Arguments()[index];
 
-		// The signature should always be an identifier, no
-		// exceptions
-		if (signature->Type() != NodeType::IDENTIFIER)
-		{
-			std::cerr << "Interpreter Error! Arguments within a function signature cannot be anything but a IDENTIFIER." << std::endl;
-			std::cerr << "Recieved type of: " << GetNodeTypeName(signature->Type()) << std::endl;
-		
-			if (m_errorHandle)
-				m_errorHandle();
-		}
-
 		// Grab the name of the function declared variable from
-		// the signature
+		// the signature, which the checker has made sure is
+		// always an identifier
 		const std::string identifier = static_cast<IdentifierNode*>(signature)->Value();
 
 		// Check if the identifier exists before adding it, and if
@@ -789,18 +2004,36 @@ Node* Interpreter::_ExecuteFunction(
 			continue;
 		}
 
-		// Try and get a identifier from global scope
-		//
-		// We grab from global scope, despite having
-		// a scope passed to us, as we don't want to
-		// have a function that is called have access
-		// to the callees variables, also that could
-		// bring many more conflicts and headaches
+		// Grab the identifier from the scope of the caller,
+		// which is only copied into the function's scope, so
+		// the function called still has no access to the
+		// caller's other variables
 		if (argument->Type() == NodeType::IDENTIFIER)
 		{
 			IdentifierNode* referencedName = static_cast<IdentifierNode*>(argument);
 
-			Node* node = m_globalScope.Search(referencedName->Value());
+			Node* node = scope.Search(referencedName->Value());
+
+			// Values are copied, so that changing an argument
+			// can never change the variable passed in
+			//
+			// Strings, arrays, and maps share their contents
+			// with the copy until either of them is changed
+			if (
+				node &&
+				(node->Type() == NodeType::INTEGER ||
+				 node->Type() == NodeType::DECIMAL ||
+				 node->Type() == NodeType::STRING  ||
+				 node->Type() == NodeType::BOOLEAN ||
+				 node->Type() == NodeType::ARRAY   ||
+				 node->Type() == NodeType::MAP     ||
+				 node->Type() == NodeType::STRUCT  ||
+				 node->Type() == NodeType::MATRIX)
+			)
+			{
+				node = m_constants.Share(node);
+				node->MarkDelete(true);
+			}
 
 			functionScope.Insert(identifier, node);
 		}
@@ -836,52 +2069,257 @@ Node* Interpreter::_ExecuteFunction(
 
 			functionScope.Insert(identifier, result);
 		}
+		else if (
+			argument->Type() == NodeType::INTEGER ||
+			argument->Type() == NodeType::DECIMAL ||
+			argument->Type() == NodeType::STRING  ||
+			argument->Type() == NodeType::BOOLEAN
+		)
+		{
+			// Use the shared constant for the literal, so
+			// the node from the AST itself is never stored
+			Node* value = m_constants.Literal(argument);
+			value->MarkDelete(true);
+
+			functionScope.Insert(identifier, value);
+		}
+		else if (argument->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+		{
+			// Copied the same as any other variable
+			Node* value = m_constants.Share(_GetArrayElement(static_cast<ArrayElementIdentifierNode*>(argument), scope));
+
+			if (value)
+				value->MarkDelete(true);
+
+			functionScope.Insert(identifier, value);
+		}
+		else if (argument->Type() == NodeType::MEMBER_IDENTIFIER)
+		{
+			Node* value = m_constants.Share(_GetMember(static_cast<MemberIdentifierNode*>(argument), scope));
+
+			if (value)
+				value->MarkDelete(true);
+
+			functionScope.Insert(identifier, value);
+		}
 		else
 			functionScope.Insert(identifier, argument);
 	}
-
-	// Now that we have all of the arguments, execute the function
-	// with the current arguments
-	Node* returnNode = nullptr;
-	
-	Execute(
-		static_cast<RootNode*>(declaration->Body()),
-		true,
-		&returnNode,
-		&functionScope
-	);
-
-	return returnNode;
 }
 
-void Interpreter::_ExecutePrint(
-	FunctionCall* print,
-	Scope&        scope
+Node* Interpreter::_ExecuteStructInstance(
+	StructDeclaration* declaration,
+	FunctionCall*      call,
+	Scope&             scope
 )
 {
-	// Be sure that this is a print call
-	if (print->Flags() != CallFlags::PRINT)
-		return;
+	const std::string name = static_cast<IdentifierNode*>(declaration->Identifier())->Value();
 
-	// Iterate through each argument and attempt
-	// to print them to the provided print handle
-	for (size_t index = 0; index < print->Arguments().size(); index++)
+	// Arguments fill in the fields in the order
+	// they are declared, so there can't be more
+	// of them than there are fields
+	if (call->Arguments().size() > declaration->Fields())
 	{
-		Node* argument = print->Arguments()[index];
+		std::cerr << "Interpreter Error! Too many arguments to create struct \"" << name << "\"!" << std::endl;
+		std::cerr << "Fields: " << declaration->Fields() << "; Got: " << call->Arguments().size() << "!" << std::endl;
 
-		// If trying to print an identifier, search for it
-		// and then if a node is found, print it out correctly
-		if (argument->Type() == NodeType::IDENTIFIER)
-		{
-			IdentifierNode* identifier = static_cast<IdentifierNode*>(argument);
+		if (m_errorHandle)
+			m_errorHandle();
 
-			Node* node = scope.Search(identifier->Value());
+		return nullptr;
+	}
 
-			_PrintTypedNode(node);
-		}
-		else if (argument->Type() == NodeType::BINARY_OP)
-		{
-			// Grab the temporary operation result
+	StructNode* instance = new StructNode();
+	instance->Type(NodeType::STRUCT);
+	instance->Declaration(declaration);
+
+	for (size_t index = 0; index < declaration->Fields(); index++)
+	{
+		Node* value = nullptr;
+
+		// Fields not passed in use the value they
+		// were declared with, which can only refer
+		// to globals, as struct declarations are
+		if (index < call->Arguments().size())
+			value = _EvaluateOwned(call->Arguments()[index], scope);
+		else if (declaration->FieldValue(index)->Type() == NodeType::ARRAY)
+			value = _EvaluateArray(
+				static_cast<ArrayNode*>(declaration->FieldValue(index)),
+				declaration->FieldName(index),
+				m_globalScope
+			);
+		else
+			value = _EvaluateOwned(declaration->FieldValue(index), m_globalScope);
+
+		if (!value)
+		{
+			std::cerr << "Interpreter Error! Field \"" << declaration->FieldName(index) << "\" of struct \"" << name << "\" has no value!" << std::endl;
+
+			delete instance;
+
+			if (m_errorHandle)
+				m_errorHandle();
+
+			return nullptr;
+		}
+
+		instance->Slot(index, value);
+	}
+
+	instance->MarkDelete(true);
+
+	return instance;
+}
+
+Node* Interpreter::_ExecuteMethod(
+	FunctionCall* call,
+	Scope&        scope
+)
+{
+	MemberIdentifierNode* member = static_cast<MemberIdentifierNode*>(call->Identifier());
+	StructNode*           object = _GetMemberObject(member, scope);
+
+	if (!object)
+		return nullptr;
+
+	// The slot is cached within the call, so calling
+	// on instances of the same struct skips the lookup
+	const StructDeclaration* structure = object->Declaration();
+	size_t                   slot      = member->Slot(structure);
+
+	if (slot == StructDeclaration::NO_MEMBER || slot < structure->Fields())
+	{
+		std::cerr << "Interpreter Error! Struct \"" << static_cast<IdentifierNode*>(structure->Identifier())->Value();
+		std::cerr << "\" has no member function \"" << member->Member() << "\"!" << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	FunctionDeclaration* declaration = structure->Method(slot - structure->Fields());
+
+	if (declaration->Arguments().size() != call->Arguments().size())
+	{
+		std::cerr << "Interpreter Error! Mismatched argument sizes!" << std::endl;
+		std::cerr << "Expected: " << declaration->Arguments().size() << "; Got: " << call->Arguments().size() << "!" << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	Scope functionScope  = { 0 };
+	functionScope.parent = &m_globalScope;
+
+	_InsertArguments(declaration, call, scope, functionScope);
+
+	// Only once the arguments are in, so that they
+	// are never mistaken for fields of the instance
+	functionScope.receiver = object;
+
+	return _ExecuteBody(declaration, functionScope);
+}
+
+StructNode* Interpreter::_GetMemberObject(
+	MemberIdentifierNode* member,
+	Scope&                scope
+)
+{
+	Node* object = member->Object();
+
+	if (object->Type() == NodeType::IDENTIFIER)
+	{
+		const std::string identifier = static_cast<IdentifierNode*>(object)->Value();
+
+		object = scope.Search(identifier);
+
+		if (!object)
+		{
+			std::cerr << "Interpreter Error! Undeclared identifier \"" << identifier << "\"!" << std::endl;
+
+			if (m_errorHandle)
+				m_errorHandle();
+
+			return nullptr;
+		}
+	}
+	else if (object->Type() == NodeType::MEMBER_IDENTIFIER)
+		object = _GetMember(static_cast<MemberIdentifierNode*>(object), scope);
+
+	if (!object)
+		return nullptr;
+
+	if (object->Type() != NodeType::STRUCT)
+	{
+		std::cerr << "Interpreter Error! Cannot access a member of a non-struct!" << std::endl;
+		std::cerr << "Type: " << GetNodeTypeName(object->Type()) << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	return static_cast<StructNode*>(object);
+}
+
+Node* Interpreter::_GetMember(
+	MemberIdentifierNode* member,
+	Scope&                scope
+)
+{
+	StructNode* object = _GetMemberObject(member, scope);
+
+	if (!object)
+		return nullptr;
+
+	size_t slot = member->Slot(object->Declaration());
+
+	if (slot >= object->Declaration()->Fields())
+	{
+		std::cerr << "Interpreter Error! Struct \"" << static_cast<IdentifierNode*>(object->Declaration()->Identifier())->Value();
+		std::cerr << "\" has no field \"" << member->Member() << "\"!" << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	return object->Slot(slot);
+}
+
+void Interpreter::_ExecutePrint(
+	FunctionCall* print,
+	Scope&        scope
+)
+{
+	// Be sure that this is a print call
+	if (print->Flags() != CallFlags::PRINT)
+		return;
+
+	// Iterate through each argument and attempt
+	// to print them to the provided print handle
+	for (size_t index = 0; index < print->Arguments().size(); index++)
+	{
+		Node* argument = print->Arguments()[index];
+
+		// If trying to print an identifier, search for it
+		// and then if a node is found, print it out correctly
+		if (argument->Type() == NodeType::IDENTIFIER)
+		{
+			IdentifierNode* identifier = static_cast<IdentifierNode*>(argument);
+
+			Node* node = scope.Search(identifier->Value());
+
+			_PrintTypedNode(node);
+		}
+		else if (argument->Type() == NodeType::BINARY_OP)
+		{
+			// Grab the temporary operation result
 			Node* result = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(argument), scope);
 
 			_PrintTypedNode(result);
@@ -935,6 +2373,21 @@ void Interpreter::_ExecutePrint(
 
 			_PrintTypedNode(result);
 		}
+		else if (argument->Type() == NodeType::MEMBER_IDENTIFIER)
+		{
+			// Grab the temporary operation result
+			Node* result = _GetMember(static_cast<MemberIdentifierNode*>(argument), scope);
+
+			if (!result)
+			{
+				std::cerr << "Interpreter Error! Member does not exist!" << std::endl;
+
+				if (m_errorHandle)
+					m_errorHandle();
+			}
+
+			_PrintTypedNode(result);
+		}
 		else
 			_PrintTypedNode(argument);
 	}
@@ -964,7 +2417,7 @@ void Interpreter::_PrintTypedNode(Node* node)
 	{
 		StringNode* string = static_cast<StringNode*>(node);
 
-		m_output << string->Value();
+		m_output.write(string->Data(), string->Length());
 
 		break;
 	}
@@ -1022,37 +2475,36 @@ Node* Interpreter::_ExecuteType(
 		Node* value = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(arg), scope);
 		argType     = value->Type();
 
-		delete value;
+		ReleaseNode(value);
 	}
 	else if (argType == NodeType::LOGICAL_OP)
 	{
 		Node* value = _ExecuteLogicalOperation(static_cast<BinaryOperation*>(arg), scope);
 		argType     = value->Type();
 
-		delete value;
+		ReleaseNode(value);
 	}
 	else if (argType == NodeType::CALL)
 	{
 		Node* value = _ExecuteFunction(static_cast<FunctionCall*>(arg), scope);
 		argType     = value->Type();
 
-		delete value;
+		ReleaseNode(value);
 	}
 	else if (argType == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 	{
 		Node* value = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(arg), scope);
 		argType = value->Type();
 	}
+	else if (argType == NodeType::MEMBER_IDENTIFIER)
+	{
+		Node* value = _GetMember(static_cast<MemberIdentifierNode*>(arg), scope);
+		argType = value->Type();
+	}
 
-	// Grab the single argument, and grab
-	// the string for it, then subsequently
-	// print the StringNode.
-	StringNode* stringRep = new StringNode();
-	stringRep->Type(NodeType::STRING);
-
-	stringRep->Value(GetNodeTypeName(argType));
-
-	return stringRep;
+	// Grab the shared string holding the
+	// name of the type
+	return m_constants.TypeName(argType);
 }
 
 Node* Interpreter::_ExecuteAmount(
@@ -1116,6 +2568,12 @@ Node* Interpreter::_ExecuteAmount(
 		currentType = value->Type();
 		deleteNode  = false;
 	}
+	else if (currentType == NodeType::MEMBER_IDENTIFIER)
+	{
+		value       = _GetMember(static_cast<MemberIdentifierNode*>(arg), scope);
+		currentType = value->Type();
+		deleteNode  = false;
+	}
 
 	// Now, check if the value is of a string
 	// or an array, and if so, return the amount
@@ -1123,30 +2581,28 @@ Node* Interpreter::_ExecuteAmount(
 	if (currentType == NodeType::ARRAY)
 	{
 		ArrayNode* arr = static_cast<ArrayNode*>(value);
-		
-		IntegerNode* amt = new IntegerNode();
-		amt->Type(NodeType::INTEGER);
-		amt->Value(false, arr->Size());
 
-		return amt;
+		return m_constants.Integer(static_cast<int32_t>(arr->Size()));
 	}
 	else if (currentType == NodeType::STRING)
 	{
 		StringNode* str = static_cast<StringNode*>(value);
 
-		IntegerNode* amt = new IntegerNode();
-		amt->Type(NodeType::INTEGER);
-		amt->Value(false, str->Value().size());
+		return m_constants.Integer(static_cast<int32_t>(str->Length()));
+	}
+	else if (currentType == NodeType::MAP)
+	{
+		MapNode* map = static_cast<MapNode*>(value);
 
-		return amt;
+		return m_constants.Integer(static_cast<int32_t>(map->Size()));
 	}
 	else
 	{
-		std::cerr << "Interpreter Error! The element to grab the \"amount\" of must be an Array or String!" << std::endl;
+		std::cerr << "Interpreter Error! The element to grab the \"amount\" of must be an Array, Map, or String!" << std::endl;
 		std::cerr << "Current type: " << GetNodeTypeName(currentType) << std::endl;
 
 		if (deleteNode)
-			delete value;
+			ReleaseNode(value);
 
 		if (m_errorHandle)
 			m_errorHandle();
@@ -1203,7 +2659,23 @@ Node* Interpreter::_ExecutePush(
 	}
 	else if (collectionType == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 	{
-		collection     = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(collectionArg), scope);
+		ArrayElementIdentifierNode* element = static_cast<ArrayElementIdentifierNode*>(collectionArg);
+
+		// The element is changed in place, so the array
+		// holding it can't share it with another array
+		Node* array = scope.Search(element->ArrayIdentifier());
+
+		if (array && array->Type() == NodeType::ARRAY)
+			static_cast<ArrayNode*>(array)->Unshare();
+		else if (array && array->Type() == NodeType::MAP)
+			static_cast<MapNode*>(array)->Unshare();
+
+		collection     = _GetArrayElement(element, scope);
+		collectionType = collection->Type();
+	}
+	else if (collectionType == NodeType::MEMBER_IDENTIFIER)
+	{
+		collection     = _GetMember(static_cast<MemberIdentifierNode*>(collectionArg), scope);
 		collectionType = collection->Type();
 	}
 	
@@ -1221,37 +2693,20 @@ Node* Interpreter::_ExecutePush(
 	}
 
 	// Check the capacity and make sure that pushing
-	// wouldn't overflow the array
-	if (collectionType == NodeType::ARRAY && static_cast<ArrayNode*>(collection)->Capacity())
+	// wouldn't overflow the array, which was already
+	// checked to be an integer when it was declared
+	if (static_cast<ArrayNode*>(collection)->Full())
 	{
-		Node*    capacity     = static_cast<ArrayNode*>(collection)->Capacity();
-		NodeType capacityType = capacity->Type();
-		size_t   amount       = static_cast<ArrayNode*>(collection)->Size();
-
-		if (capacityType != NodeType::INTEGER)
-		{
-			std::cerr << "Interpreter Error! Array capacity must be an integer!" << std::endl;
-			std::cerr << "Capacity type: " << GetNodeTypeName(capacityType) << std::endl;
+		size_t amount = static_cast<ArrayNode*>(collection)->Size();
 
-			if (m_errorHandle)
-				m_errorHandle();
-
-			return nullptr;
-		}
-
-		int32_t capacityValue = static_cast<IntegerNode*>(capacity)->Value();
-
-		if (amount + 1 > static_cast<size_t>(capacityValue))
-		{
-			std::cerr << "Interpreter Error! Cannot push an array over capacity!" << std::endl;
-			std::cerr << "Capacity: " << capacityValue << std::endl;
-			std::cerr << "Amount: " << (amount + 1) << std::endl;
+		std::cerr << "Interpreter Error! Cannot push an array over capacity!" << std::endl;
+		std::cerr << "Capacity: " << static_cast<ArrayNode*>(collection)->Limit() << std::endl;
+		std::cerr << "Amount: " << (amount + 1) << std::endl;
 
-			if (m_errorHandle)
-				m_errorHandle();
+		if (m_errorHandle)
+			m_errorHandle();
 
-			return nullptr;
-		}
+		return nullptr;
 	}
 
 	// If the argument is of a type, such
@@ -1265,7 +2720,7 @@ Node* Interpreter::_ExecutePush(
 	// trying to evaluate the type of argument
 	if (valueType == NodeType::IDENTIFIER)
 	{
-		value     = scope.Search(static_cast<IdentifierNode*>(valueArg)->Value())->Clone();
+		value     = m_constants.Share(scope.Search(static_cast<IdentifierNode*>(valueArg)->Value()));
 		valueType = value->Type();
 	}
 	else if (valueType == NodeType::CALL)
@@ -1285,9 +2740,23 @@ Node* Interpreter::_ExecutePush(
 	}
 	else if (valueType == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 	{
-		value     = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(valueArg), scope)->Clone();
+		value     = m_constants.Share(_GetArrayElement(static_cast<ArrayElementIdentifierNode*>(valueArg), scope));
+		valueType = value->Type();
+	}
+	else if (valueType == NodeType::MEMBER_IDENTIFIER)
+	{
+		value     = m_constants.Share(_GetMember(static_cast<MemberIdentifierNode*>(valueArg), scope));
 		valueType = value->Type();
 	}
+	// Literals use their shared constant, as the
+	// node from the AST can't be stored in the array
+	else if (
+		valueType == NodeType::INTEGER ||
+		valueType == NodeType::DECIMAL ||
+		valueType == NodeType::STRING  ||
+		valueType == NodeType::BOOLEAN
+	)
+		value = m_constants.Literal(valueArg);
 
 	// Finally, insert the element at the end of the collection
 	if (collectionType == NodeType::ARRAY)
@@ -1342,10 +2811,51 @@ Node* Interpreter::_ExecutePop(
 	}
 	else if (collectionType == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 	{
-		collection     = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(collectionArg), scope);
+		ArrayElementIdentifierNode* element = static_cast<ArrayElementIdentifierNode*>(collectionArg);
+
+		// The element is changed in place, so the array
+		// holding it can't share it with another array
+		Node* array = scope.Search(element->ArrayIdentifier());
+
+		if (array && array->Type() == NodeType::ARRAY)
+			static_cast<ArrayNode*>(array)->Unshare();
+		else if (array && array->Type() == NodeType::MAP)
+			static_cast<MapNode*>(array)->Unshare();
+
+		collection     = _GetArrayElement(element, scope);
+		collectionType = collection->Type();
+	}
+	else if (collectionType == NodeType::MEMBER_IDENTIFIER)
+	{
+		collection     = _GetMember(static_cast<MemberIdentifierNode*>(collectionArg), scope);
 		collectionType = collection->Type();
 	}
 
+	// Popping from a map removes a key
+	if (collectionType == NodeType::MAP)
+	{
+		bool  temporary = false;
+		Node* key       = _EvaluateArgument(pop->Arguments()[1], scope, temporary);
+
+		if (!key || !MapNode::Hashable(key) || !static_cast<MapNode*>(collection)->Remove(key))
+		{
+			std::cerr << "Interpreter Error! The \"pop\" call's key must be within the map!" << std::endl;
+
+			if (temporary)
+				ReleaseNode(key);
+
+			if (m_errorHandle)
+				m_errorHandle();
+
+			return nullptr;
+		}
+
+		if (temporary)
+			ReleaseNode(key);
+
+		return nullptr;
+	}
+
 	// Make sure that the current argument is either
 	// an array or a string
 	if (collectionType != NodeType::ARRAY)
@@ -1368,7 +2878,7 @@ Node* Interpreter::_ExecutePop(
 	// trying to evaluate the type of argument
 	if (valueType == NodeType::IDENTIFIER)
 	{
-		value = scope.Search(static_cast<IdentifierNode*>(valueArg)->Value())->Clone();
+		value = scope.Search(static_cast<IdentifierNode*>(valueArg)->Value());
 		valueType = value->Type();
 	}
 	else if (valueType == NodeType::CALL)
@@ -1388,7 +2898,12 @@ Node* Interpreter::_ExecutePop(
 	}
 	else if (valueType == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 	{
-		value = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(valueArg), scope)->Clone();
+		value = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(valueArg), scope);
+		valueType = value->Type();
+	}
+	else if (valueType == NodeType::MEMBER_IDENTIFIER)
+	{
+		value = _GetMember(static_cast<MemberIdentifierNode*>(valueArg), scope);
 		valueType = value->Type();
 	}
 
@@ -1473,9 +2988,9 @@ Node* Interpreter::_ExecuteIntegerCast(
 	// the current argument type
 	if (currentType == NodeType::IDENTIFIER)
 	{
-		value       = scope.Search(static_cast<IdentifierNode*>(value)->Value())->Clone();
+		value       = scope.Search(static_cast<IdentifierNode*>(value)->Value());
 		currentType = value->Type();
-		requiresDel = true;
+		requiresDel = false;
 	}
 	else if (currentType == NodeType::BINARY_OP)
 	{
@@ -1499,7 +3014,13 @@ Node* Interpreter::_ExecuteIntegerCast(
 	{
 		value       = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(value), scope);
 		currentType = value->Type();
-		requiresDel = true;
+		requiresDel = false;
+	}
+	else if (currentType == NodeType::MEMBER_IDENTIFIER)
+	{
+		value       = _GetMember(static_cast<MemberIdentifierNode*>(value), scope);
+		currentType = value->Type();
+		requiresDel = false;
 	}
 
 	// Now, check if the type is already
@@ -1507,12 +3028,12 @@ Node* Interpreter::_ExecuteIntegerCast(
 	// return the value node
 	if (currentType == NodeType::INTEGER)
 	{
-		Node* returnNode = value->Clone();
-
+		// Temporary values can be returned as is,
+		// otherwise share or copy the value
 		if (requiresDel)
-			delete value;
+			return value;
 
-		return returnNode;
+		return m_constants.Share(value);
 	}
 	// If this is a decimal value, just floor
 	// it and set a new node with the floored
@@ -1521,13 +3042,11 @@ Node* Interpreter::_ExecuteIntegerCast(
 	{
 		float decimalValue = static_cast<DecimalNode*>(value)->Value();
 
-		// Create the returnable integer node
-		IntegerNode* castedNode = new IntegerNode();
-		castedNode->Type(NodeType::INTEGER);
-		castedNode->Value(false, static_cast<int32_t>(std::floor(decimalValue)));
+		// Grab the returnable integer node
+		IntegerNode* castedNode = m_constants.Integer(static_cast<int32_t>(std::floor(decimalValue)));
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
@@ -1537,13 +3056,11 @@ Node* Interpreter::_ExecuteIntegerCast(
 	{
 		bool boolValue = static_cast<BooleanNode*>(value)->Value();
 
-		// Create the returnable integer node
-		IntegerNode* castedNode = new IntegerNode();
-		castedNode->Type(NodeType::INTEGER);
-		castedNode->Value(false, ((boolValue) ? 1 : 0));
+		// Grab the returnable integer node
+		IntegerNode* castedNode = m_constants.Integer(((boolValue) ? 1 : 0));
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
@@ -1564,7 +3081,7 @@ Node* Interpreter::_ExecuteIntegerCast(
 		catch (std::invalid_argument const&)
 		{
 			if (requiresDel)
-				delete value;
+				ReleaseNode(value);
 
 			std::cerr << "Interpreter Error! Invalid string used with \"integer\" caster!" << std::endl;
 			std::cerr << "String value: " << stringValue << std::endl;
@@ -1575,19 +3092,17 @@ Node* Interpreter::_ExecuteIntegerCast(
 			return nullptr;
 		}
 
-		// Create the returnable integer node
-		IntegerNode* castedNode = new IntegerNode();
-		castedNode->Type(NodeType::INTEGER);
-		castedNode->Value(false, castedValue);
+		// Grab the returnable integer node
+		IntegerNode* castedNode = m_constants.Integer(castedValue);
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
 
 	if (requiresDel)
-		delete value;
+		ReleaseNode(value);
 
 	return nullptr;
 }
@@ -1625,9 +3140,9 @@ Node* Interpreter::_ExecuteDecimalCast(
 	// the current argument type
 	if (currentType == NodeType::IDENTIFIER)
 	{
-		value       = scope.Search(static_cast<IdentifierNode*>(value)->Value())->Clone();
+		value       = scope.Search(static_cast<IdentifierNode*>(value)->Value());
 		currentType = value->Type();
-		requiresDel = true;
+		requiresDel = false;
 	}
 	else if (currentType == NodeType::BINARY_OP)
 	{
@@ -1651,7 +3166,13 @@ Node* Interpreter::_ExecuteDecimalCast(
 	{
 		value       = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(value), scope);
 		currentType = value->Type();
-		requiresDel = true;
+		requiresDel = false;
+	}
+	else if (currentType == NodeType::MEMBER_IDENTIFIER)
+	{
+		value       = _GetMember(static_cast<MemberIdentifierNode*>(value), scope);
+		currentType = value->Type();
+		requiresDel = false;
 	}
 
 	// Now, check if the type is already
@@ -1659,12 +3180,12 @@ Node* Interpreter::_ExecuteDecimalCast(
 	// return the value node
 	if (currentType == NodeType::DECIMAL)
 	{
-		Node* returnNode = value->Clone();
-
+		// Temporary values can be returned as is,
+		// otherwise share or copy the value
 		if (requiresDel)
-			delete value;
+			return value;
 
-		return returnNode;
+		return m_constants.Share(value);
 	}
 	// If this is a decimal value, just floor
 	// it and set a new node with the floored
@@ -1679,7 +3200,7 @@ Node* Interpreter::_ExecuteDecimalCast(
 		castedNode->Value(false, static_cast<float>(integerValue));
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
@@ -1695,7 +3216,7 @@ Node* Interpreter::_ExecuteDecimalCast(
 		castedNode->Value(false, ((boolValue) ? 1.0f : 0.0f));
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
@@ -1716,7 +3237,7 @@ Node* Interpreter::_ExecuteDecimalCast(
 		catch (std::invalid_argument const&)
 		{
 			if (requiresDel)
-				delete value;
+				ReleaseNode(value);
 
 			std::cerr << "Interpreter Error! Invalid string used with \"decimal\" caster!" << std::endl;
 			std::cerr << "String value: " << stringValue << std::endl;
@@ -1733,13 +3254,13 @@ Node* Interpreter::_ExecuteDecimalCast(
 		castedNode->Value(false, castedValue);
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
 
 	if (requiresDel)
-		delete value;
+		ReleaseNode(value);
 
 	return nullptr;
 }
@@ -1777,9 +3298,9 @@ Node* Interpreter::_ExecuteStringCast(
 	// the current argument type
 	if (currentType == NodeType::IDENTIFIER)
 	{
-		value = scope.Search(static_cast<IdentifierNode*>(value)->Value())->Clone();
+		value = scope.Search(static_cast<IdentifierNode*>(value)->Value());
 		currentType = value->Type();
-		requiresDel = true;
+		requiresDel = false;
 	}
 	else if (currentType == NodeType::BINARY_OP)
 	{
@@ -1803,7 +3324,13 @@ Node* Interpreter::_ExecuteStringCast(
 	{
 		value = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(value), scope);
 		currentType = value->Type();
-		requiresDel = true;
+		requiresDel = false;
+	}
+	else if (currentType == NodeType::MEMBER_IDENTIFIER)
+	{
+		value = _GetMember(static_cast<MemberIdentifierNode*>(value), scope);
+		currentType = value->Type();
+		requiresDel = false;
 	}
 
 	// Now, check if the type is already
@@ -1811,12 +3338,12 @@ Node* Interpreter::_ExecuteStringCast(
 	// return the value node
 	if (currentType == NodeType::STRING)
 	{
-		Node* returnNode = value->Clone();
-
+		// Temporary values can be returned as is,
+		// otherwise share or copy the value
 		if (requiresDel)
-			delete value;
+			return value;
 
-		return returnNode;
+		return m_constants.Share(value);
 	}
 	// If this is a decimal value, just floor
 	// it and set a new node with the floored
@@ -1831,7 +3358,7 @@ Node* Interpreter::_ExecuteStringCast(
 		castedNode->Value(std::to_string(integerValue));
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
@@ -1841,13 +3368,11 @@ Node* Interpreter::_ExecuteStringCast(
 	{
 		bool boolValue = static_cast<BooleanNode*>(value)->Value();
 
-		// Create the returnable integer node
-		StringNode* castedNode = new StringNode();
-		castedNode->Type(NodeType::STRING);
-		castedNode->Value(((boolValue) ? "true" : "false"));
+		// Grab the returnable string node
+		StringNode* castedNode = m_constants.String(((boolValue) ? "true" : "false"));
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
@@ -1875,13 +3400,13 @@ Node* Interpreter::_ExecuteStringCast(
 		castedNode->Value(decimalString);
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
 
 	if (requiresDel)
-		delete value;
+		ReleaseNode(value);
 
 	return nullptr;
 }
@@ -1919,9 +3444,9 @@ Node* Interpreter::_ExecuteBooleanCast(
 	// the current argument type
 	if (currentType == NodeType::IDENTIFIER)
 	{
-		value = scope.Search(static_cast<IdentifierNode*>(value)->Value())->Clone();
+		value = scope.Search(static_cast<IdentifierNode*>(value)->Value());
 		currentType = value->Type();
-		requiresDel = true;
+		requiresDel = false;
 	}
 	else if (currentType == NodeType::BINARY_OP)
 	{
@@ -1945,7 +3470,13 @@ Node* Interpreter::_ExecuteBooleanCast(
 	{
 		value = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(value), scope);
 		currentType = value->Type();
-		requiresDel = true;
+		requiresDel = false;
+	}
+	else if (currentType == NodeType::MEMBER_IDENTIFIER)
+	{
+		value = _GetMember(static_cast<MemberIdentifierNode*>(value), scope);
+		currentType = value->Type();
+		requiresDel = false;
 	}
 
 	// Now, check if the type is already
@@ -1953,12 +3484,12 @@ Node* Interpreter::_ExecuteBooleanCast(
 	// return the value node
 	if (currentType == NodeType::BOOLEAN)
 	{
-		Node* returnNode = value->Clone();
-
+		// Temporary values can be returned as is,
+		// otherwise share or copy the value
 		if (requiresDel)
-			delete value;
+			return value;
 
-		return returnNode;
+		return m_constants.Share(value);
 	}
 	// If this is a decimal value, just floor
 	// it and set a new node with the floored
@@ -1967,13 +3498,11 @@ Node* Interpreter::_ExecuteBooleanCast(
 	{
 		int32_t integerValue = static_cast<IntegerNode*>(value)->Value();
 
-		// Create the returnable integer node
-		BooleanNode* castedNode = new BooleanNode();
-		castedNode->Type(NodeType::BOOLEAN);
-		castedNode->Value((integerValue >= 1));
+		// Grab the returnable boolean node
+		BooleanNode* castedNode = m_constants.Boolean((integerValue >= 1));
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
@@ -1983,13 +3512,11 @@ Node* Interpreter::_ExecuteBooleanCast(
 	{
 		float decimalValue = static_cast<DecimalNode*>(value)->Value();
 
-		// Create the returnable integer node
-		BooleanNode* castedNode = new BooleanNode();
-		castedNode->Type(NodeType::BOOLEAN);
-		castedNode->Value((decimalValue >= 1.0f));
+		// Grab the returnable boolean node
+		BooleanNode* castedNode = m_constants.Boolean((decimalValue >= 1.0f));
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
@@ -2000,19 +3527,17 @@ Node* Interpreter::_ExecuteBooleanCast(
 	{
 		std::string stringValue = static_cast<StringNode*>(value)->Value();
 
-		// Create the returnable integer node
-		BooleanNode* castedNode = new BooleanNode();
-		castedNode->Type(NodeType::BOOLEAN);
-		castedNode->Value((stringValue == "true"));
+		// Grab the returnable boolean node
+		BooleanNode* castedNode = m_constants.Boolean((stringValue == "true"));
 
 		if (requiresDel)
-			delete value;
+			ReleaseNode(value);
 
 		return castedNode;
 	}
 
 	if (requiresDel)
-		delete value;
+		ReleaseNode(value);
 
 	return nullptr;
 }
@@ -2022,11 +3547,23 @@ Node* Interpreter::_ExecuteBinaryOperation(
 	Scope&                scope
 )
 {
+	if (operation->HoistedLoop())
+		return _ExecuteHoisted(operation, scope);
+
+	if (operation->Proven())
+	{
+		Node* result = _ExecuteProvenOperation(operation, scope);
+
+		if (result)
+			return result;
+	}
+
 	// Try and grab left and right hand of the
 	// operation
-	Node* leftHand  = operation->GetLeftHand();
-	Node* rightHand = operation->GetRightHand();
-	Node* result    = nullptr;
+	Node*    leftHand   = operation->GetLeftHand();
+	Node*    rightHand  = operation->GetRightHand();
+	Node*    result     = nullptr;
+	NodeType resultType = NodeType::ROOT;
 
 	// Grab the global variable for the identifier
 	// to be used for operating
@@ -2038,6 +3575,8 @@ Node* Interpreter::_ExecuteBinaryOperation(
 		leftHand = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(leftHand), scope);
 	else if (leftHand->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 		leftHand = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(leftHand), scope);
+	else if (leftHand->Type() == NodeType::MEMBER_IDENTIFIER)
+		leftHand = _GetMember(static_cast<MemberIdentifierNode*>(leftHand), scope);
 	// For now, check if the left hand type is not a
 	// operatable type, such as a string or an
 	// integer, and if not, throw an error
@@ -2065,6 +3604,8 @@ Node* Interpreter::_ExecuteBinaryOperation(
 		rightHand = _ExecuteFunction(static_cast<FunctionCall*>(rightHand), scope);
 	else if (rightHand->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 		rightHand = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(rightHand), scope);
+	else if (rightHand->Type() == NodeType::MEMBER_IDENTIFIER)
+		rightHand = _GetMember(static_cast<MemberIdentifierNode*>(rightHand), scope);
 	// Do the same as with the left hand, check if it is not
 	// an operatable type, and if so throw an error
 	else if (
@@ -2090,6 +3631,10 @@ Node* Interpreter::_ExecuteBinaryOperation(
 	//
 	// If the type is a string and any other type is
 	// attempted to be operated to it, throw an error
+	//
+	// Integers and booleans are grabbed from the constant
+	// pool once the value is known, so only decimals and
+	// strings are allocated up front
 	if (
 		(leftHand->Type()  == NodeType::DECIMAL  ||
 		 rightHand->Type() == NodeType::DECIMAL) &&
@@ -2100,16 +3645,15 @@ Node* Interpreter::_ExecuteBinaryOperation(
 	{
 		result = new DecimalNode();
 		result->Type(NodeType::DECIMAL);
+
+		resultType = NodeType::DECIMAL;
 	}
 	else if (
 		leftHand->Type() == NodeType::INTEGER &&
 		rightHand->Type() == NodeType::INTEGER &&
 		!isComparison
 	)
-	{
-		result = new IntegerNode();
-		result->Type(NodeType::INTEGER);
-	}
+		resultType = NodeType::INTEGER;
 	else if (
 		leftHand->Type() == NodeType::STRING  &&
 		rightHand->Type() == NodeType::STRING &&
@@ -2118,23 +3662,22 @@ Node* Interpreter::_ExecuteBinaryOperation(
 	{
 		result = new StringNode();
 		result->Type(NodeType::STRING);
+
+		resultType = NodeType::STRING;
 	}
 	else if (
 		isComparison &&
 		leftHand->Type() == rightHand->Type()
 	)
-	{
-		result = new BooleanNode();
-		result->Type(NodeType::BOOLEAN);
-	}
-	else
+		resultType = NodeType::BOOLEAN;
+	else
 	{
 		std::cerr << "Interpreter Error! Mismatched type for operation." << std::endl;
 		std::cerr << "Left-hand type: " << GetNodeTypeName(leftHand->Type()) << ";";
 		std::cerr << " Right-hand type: " << GetNodeTypeName(rightHand->Type()) << std::endl;
 
-		delete leftHand;
-		delete rightHand;
+		ReleaseNode(leftHand);
+		ReleaseNode(rightHand);
 
 		if (m_errorHandle)
 			m_errorHandle();
@@ -2150,7 +3693,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 	{
 	case NodeType::ADD:
 	{
-		if (result->Type() == NodeType::DECIMAL)
+		if (resultType == NodeType::DECIMAL)
 		{
 			float leftVal  = 0.0f;
 			float rightVal = 0.0f;
@@ -2171,20 +3714,19 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			
 			return result;
 		}
-		else if (result->Type() == NodeType::INTEGER)
+		else if (resultType == NodeType::INTEGER)
 		{
-			static_cast<IntegerNode*>(result)->Value(
-				false,
-				static_cast<IntegerNode*>(leftHand)->Value() + static_cast<IntegerNode*>(rightHand)->Value()
-			);
+			result = m_constants.Integer(static_cast<IntegerNode*>(leftHand)->Value() + static_cast<IntegerNode*>(rightHand)->Value());
 
 			return result;
 		}
-		else if (result->Type() == NodeType::STRING)
+		else if (resultType == NodeType::STRING)
 		{
-			static_cast<StringNode*>(result)->Value(
-				static_cast<StringNode*>(leftHand)->Value() + static_cast<StringNode*>(rightHand)->Value()
+			static_cast<StringNode*>(result)->Reserve(
+				static_cast<StringNode*>(leftHand)->Length() + static_cast<StringNode*>(rightHand)->Length()
 			);
+			static_cast<StringNode*>(result)->Append(*static_cast<StringNode*>(leftHand));
+			static_cast<StringNode*>(result)->Append(*static_cast<StringNode*>(rightHand));
 
 			return result;
 		}
@@ -2193,7 +3735,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 	}
 	case NodeType::SUBTRACT:
 	{
-		if (result->Type() == NodeType::DECIMAL)
+		if (resultType == NodeType::DECIMAL)
 		{
 			float leftVal  = 0.0f;
 			float rightVal = 0.0f;
@@ -2214,21 +3756,18 @@ Node* Interpreter::_ExecuteBinaryOperation(
 
 			return result;
 		}
-		else if (result->Type() == NodeType::INTEGER)
+		else if (resultType == NodeType::INTEGER)
 		{
-			static_cast<IntegerNode*>(result)->Value(
-				false,
-				static_cast<IntegerNode*>(leftHand)->Value() - static_cast<IntegerNode*>(rightHand)->Value()
-			);
+			result = m_constants.Integer(static_cast<IntegerNode*>(leftHand)->Value() - static_cast<IntegerNode*>(rightHand)->Value());
 
 			return result;
 		}
-		else if (result->Type() == NodeType::STRING)
+		else if (resultType == NodeType::STRING)
 		{
 			std::cerr << "Interpreter Error! Cannot subtract a string from a string!" << std::endl;
 
-			delete leftHand;
-			delete rightHand;
+			ReleaseNode(leftHand);
+			ReleaseNode(rightHand);
 
 			if (m_errorHandle)
 				m_errorHandle();
@@ -2240,7 +3779,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 	}
 	case NodeType::MULTIPLY:
 	{
-		if (result->Type() == NodeType::DECIMAL)
+		if (resultType == NodeType::DECIMAL)
 		{
 			float leftVal  = 0.0f;
 			float rightVal = 0.0f;
@@ -2261,21 +3800,18 @@ Node* Interpreter::_ExecuteBinaryOperation(
 
 			return result;
 		}
-		else if (result->Type() == NodeType::INTEGER)
+		else if (resultType == NodeType::INTEGER)
 		{
-			static_cast<IntegerNode*>(result)->Value(
-				false,
-				static_cast<IntegerNode*>(leftHand)->Value() * static_cast<IntegerNode*>(rightHand)->Value()
-			);
+			result = m_constants.Integer(static_cast<IntegerNode*>(leftHand)->Value() * static_cast<IntegerNode*>(rightHand)->Value());
 
 			return result;
 		}
-		else if (result->Type() == NodeType::STRING)
+		else if (resultType == NodeType::STRING)
 		{
 			std::cerr << "Interpreter Error! Cannot multply a string by a string!" << std::endl;
 
-			delete leftHand;
-			delete rightHand;
+			ReleaseNode(leftHand);
+			ReleaseNode(rightHand);
 
 			if (m_errorHandle)
 				m_errorHandle();
@@ -2287,7 +3823,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 	}
 	case NodeType::DIVIDE:
 	{
-		if (result->Type() == NodeType::DECIMAL)
+		if (resultType == NodeType::DECIMAL)
 		{
 			float leftVal  = 0.0f;
 			float rightVal = 0.0f;
@@ -2308,16 +3844,13 @@ Node* Interpreter::_ExecuteBinaryOperation(
 
 			return result;
 		}
-		else if (result->Type() == NodeType::INTEGER)
+		else if (resultType == NodeType::INTEGER)
 		{
-			static_cast<IntegerNode*>(result)->Value(
-				false,
-				static_cast<IntegerNode*>(leftHand)->Value() / static_cast<IntegerNode*>(rightHand)->Value()
-			);
+			result = m_constants.Integer(static_cast<IntegerNode*>(leftHand)->Value() / static_cast<IntegerNode*>(rightHand)->Value());
 
 			return result;
 		}
-		else if (result->Type() == NodeType::STRING)
+		else if (resultType == NodeType::STRING)
 		{
 			std::cerr << "Interpreter Error! Cannot divide a string by a string!" << std::endl;
 	
@@ -2331,7 +3864,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 	}
 	case NodeType::MODULUS:
 	{
-		if (result->Type() == NodeType::DECIMAL)
+		if (resultType == NodeType::DECIMAL)
 		{
 			float leftVal  = 0.0f;
 			float rightVal = 0.0f;
@@ -2352,16 +3885,13 @@ Node* Interpreter::_ExecuteBinaryOperation(
 
 			return result;
 		}
-		else if (result->Type() == NodeType::INTEGER)
+		else if (resultType == NodeType::INTEGER)
 		{
-			static_cast<IntegerNode*>(result)->Value(
-				false,
-				static_cast<IntegerNode*>(leftHand)->Value() % static_cast<IntegerNode*>(rightHand)->Value()
-			);
+			result = m_constants.Integer(static_cast<IntegerNode*>(leftHand)->Value() % static_cast<IntegerNode*>(rightHand)->Value());
 
 			return result;
 		}
-		else if (result->Type() == NodeType::STRING)
+		else if (resultType == NodeType::STRING)
 		{
 			std::cerr << "Interpreter Error! Cannot modulus a string!" << std::endl;
 
@@ -2386,7 +3916,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			IntegerNode* leftInt = static_cast<IntegerNode*>(leftHand);
 			IntegerNode* rightInt = static_cast<IntegerNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftInt->Value() == rightInt->Value());
+			result = m_constants.Boolean(leftInt->Value() == rightInt->Value());
 
 			break;
 		}
@@ -2395,7 +3925,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			DecimalNode* leftDec = static_cast<DecimalNode*>(leftHand);
 			DecimalNode* rightDec = static_cast<DecimalNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftDec->Value() == rightDec->Value());
+			result = m_constants.Boolean(leftDec->Value() == rightDec->Value());
 
 			break;
 		}
@@ -2404,7 +3934,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			StringNode* leftStr = static_cast<StringNode*>(leftHand);
 			StringNode* rightStr = static_cast<StringNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftStr->Value() == rightStr->Value());
+			result = m_constants.Boolean(leftStr->Equals(*rightStr));
 
 			break;
 		}
@@ -2413,7 +3943,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			BooleanNode* leftBool = static_cast<BooleanNode*>(leftHand);
 			BooleanNode* rightBool = static_cast<BooleanNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftBool->Value() == rightBool->Value());
+			result = m_constants.Boolean(leftBool->Value() == rightBool->Value());
 
 			break;
 		}
@@ -2434,7 +3964,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			IntegerNode* leftInt = static_cast<IntegerNode*>(leftHand);
 			IntegerNode* rightInt = static_cast<IntegerNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftInt->Value() != rightInt->Value());
+			result = m_constants.Boolean(leftInt->Value() != rightInt->Value());
 
 			break;
 		}
@@ -2443,7 +3973,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			DecimalNode* leftDec = static_cast<DecimalNode*>(leftHand);
 			DecimalNode* rightDec = static_cast<DecimalNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftDec->Value() != rightDec->Value());
+			result = m_constants.Boolean(leftDec->Value() != rightDec->Value());
 
 			break;
 		}
@@ -2452,7 +3982,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			StringNode* leftStr = static_cast<StringNode*>(leftHand);
 			StringNode* rightStr = static_cast<StringNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftStr->Value() != rightStr->Value());
+			result = m_constants.Boolean(!leftStr->Equals(*rightStr));
 
 			break;
 		}
@@ -2461,7 +3991,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			BooleanNode* leftBool = static_cast<BooleanNode*>(leftHand);
 			BooleanNode* rightBool = static_cast<BooleanNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftBool->Value() != rightBool->Value());
+			result = m_constants.Boolean(leftBool->Value() != rightBool->Value());
 
 			break;
 		}
@@ -2482,7 +4012,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			IntegerNode* leftInt  = static_cast<IntegerNode*>(leftHand);
 			IntegerNode* rightInt = static_cast<IntegerNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftInt->Value() < rightInt->Value());
+			result = m_constants.Boolean(leftInt->Value() < rightInt->Value());
 
 			break;
 		}
@@ -2491,7 +4021,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			DecimalNode* leftDec  = static_cast<DecimalNode*>(leftHand);
 			DecimalNode* rightDec = static_cast<DecimalNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftDec->Value() < rightDec->Value());
+			result = m_constants.Boolean(leftDec->Value() < rightDec->Value());
 
 			break;
 		}
@@ -2522,7 +4052,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			IntegerNode* leftInt  = static_cast<IntegerNode*>(leftHand);
 			IntegerNode* rightInt = static_cast<IntegerNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftInt->Value() > rightInt->Value());
+			result = m_constants.Boolean(leftInt->Value() > rightInt->Value());
 
 			break;
 		}
@@ -2531,7 +4061,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			DecimalNode* leftDec  = static_cast<DecimalNode*>(leftHand);
 			DecimalNode* rightDec = static_cast<DecimalNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftDec->Value() > rightDec->Value());
+			result = m_constants.Boolean(leftDec->Value() > rightDec->Value());
 
 			break;
 		}
@@ -2562,7 +4092,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			IntegerNode* leftInt  = static_cast<IntegerNode*>(leftHand);
 			IntegerNode* rightInt = static_cast<IntegerNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftInt->Value() <= rightInt->Value());
+			result = m_constants.Boolean(leftInt->Value() <= rightInt->Value());
 
 			break;
 		}
@@ -2571,7 +4101,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			DecimalNode* leftDec  = static_cast<DecimalNode*>(leftHand);
 			DecimalNode* rightDec = static_cast<DecimalNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftDec->Value() <= rightDec->Value());
+			result = m_constants.Boolean(leftDec->Value() <= rightDec->Value());
 
 			break;
 		}
@@ -2602,7 +4132,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			IntegerNode* leftInt = static_cast<IntegerNode*>(leftHand);
 			IntegerNode* rightInt = static_cast<IntegerNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftInt->Value() >= rightInt->Value());
+			result = m_constants.Boolean(leftInt->Value() >= rightInt->Value());
 
 			break;
 		}
@@ -2611,7 +4141,7 @@ Node* Interpreter::_ExecuteBinaryOperation(
 			DecimalNode* leftDec = static_cast<DecimalNode*>(leftHand);
 			DecimalNode* rightDec = static_cast<DecimalNode*>(rightHand);
 
-			static_cast<BooleanNode*>(result)->Value(leftDec->Value() >= rightDec->Value());
+			result = m_constants.Boolean(leftDec->Value() >= rightDec->Value());
 
 			break;
 		}
@@ -2644,16 +4174,171 @@ Node* Interpreter::_ExecuteBinaryOperation(
 	return nullptr;
 }
 
+Node* Interpreter::_ExecuteProvenOperation(
+	BinaryOperation* operation,
+	Scope&           scope
+)
+{
+	if (operation->ProvenType() == NodeType::INTEGER)
+	{
+		int32_t value = 0;
+
+		return (_EvaluateInteger(operation, scope, value)) ? m_constants.Integer(value) : nullptr;
+	}
+	else if (operation->ProvenType() == NodeType::DECIMAL)
+	{
+		float value = 0.0f;
+
+		if (!_EvaluateDecimal(operation, scope, value))
+			return nullptr;
+
+		DecimalNode* result = new DecimalNode();
+		result->Type(NodeType::DECIMAL);
+		result->Value(false, value);
+
+		return result;
+	}
+
+	// Otherwise, this is a comparison of two sides
+	// proven to be the same type
+	NodeType type = NodeType::ROOT;
+
+	ASTTypeInferrer::ProvenType(operation->GetLeftHand(), type);
+
+	if (type == NodeType::INTEGER)
+	{
+		int32_t leftHand  = 0;
+		int32_t rightHand = 0;
+
+		if (
+			!_EvaluateInteger(operation->GetLeftHand(), scope, leftHand) ||
+			!_EvaluateInteger(operation->GetRightHand(), scope, rightHand)
+		)
+			return nullptr;
+
+		return m_constants.Boolean(Compare(operation->Operation(), leftHand, rightHand));
+	}
+
+	float leftHand  = 0.0f;
+	float rightHand = 0.0f;
+
+	if (
+		!_EvaluateDecimal(operation->GetLeftHand(), scope, leftHand) ||
+		!_EvaluateDecimal(operation->GetRightHand(), scope, rightHand)
+	)
+		return nullptr;
+
+	return m_constants.Boolean(Compare(operation->Operation(), leftHand, rightHand));
+}
+
+bool Interpreter::_EvaluateInteger(
+	Node*    expression,
+	Scope&   scope,
+	int32_t& value
+)
+{
+	if (expression->Type() == NodeType::INTEGER)
+	{
+		value = static_cast<IntegerNode*>(expression)->Value();
+
+		return true;
+	}
+	else if (expression->Type() == NodeType::IDENTIFIER)
+	{
+		// Variables are only missing, or of another type,
+		// if reading or assigning them reported an error
+		Node* variable = scope.Search(static_cast<IdentifierNode*>(expression)->Value());
+
+		if (!variable || variable->Type() != NodeType::INTEGER)
+			return false;
+
+		value = static_cast<IntegerNode*>(variable)->Value();
+
+		return true;
+	}
+
+	BinaryOperation* operation = static_cast<BinaryOperation*>(expression);
+
+	int32_t leftHand  = 0;
+	int32_t rightHand = 0;
+
+	if (
+		!_EvaluateInteger(operation->GetLeftHand(), scope, leftHand) ||
+		!_EvaluateInteger(operation->GetRightHand(), scope, rightHand)
+	)
+		return false;
+
+	return Arithmetic(operation->Operation(), leftHand, rightHand, value);
+}
+
+bool Interpreter::_EvaluateDecimal(
+	Node*  expression,
+	Scope& scope,
+	float& value
+)
+{
+	NodeType type = NodeType::ROOT;
+
+	ASTTypeInferrer::ProvenType(expression, type);
+
+	// Integers are converted the same as when an
+	// operation has a decimal on only one side
+	if (type == NodeType::INTEGER)
+	{
+		int32_t integer = 0;
+
+		if (!_EvaluateInteger(expression, scope, integer))
+			return false;
+
+		value = static_cast<float>(integer);
+
+		return true;
+	}
+
+	if (expression->Type() == NodeType::DECIMAL)
+	{
+		value = static_cast<DecimalNode*>(expression)->Value();
+
+		return true;
+	}
+	else if (expression->Type() == NodeType::IDENTIFIER)
+	{
+		Node* variable = scope.Search(static_cast<IdentifierNode*>(expression)->Value());
+
+		if (!variable || variable->Type() != NodeType::DECIMAL)
+			return false;
+
+		value = static_cast<DecimalNode*>(variable)->Value();
+
+		return true;
+	}
+
+	BinaryOperation* operation = static_cast<BinaryOperation*>(expression);
+
+	float leftHand  = 0.0f;
+	float rightHand = 0.0f;
+
+	if (
+		!_EvaluateDecimal(operation->GetLeftHand(), scope, leftHand) ||
+		!_EvaluateDecimal(operation->GetRightHand(), scope, rightHand)
+	)
+		return false;
+
+	return Arithmetic(operation->Operation(), leftHand, rightHand, value);
+}
+
 BooleanNode* Interpreter::_ExecuteLogicalOperation(
 	BinaryOperation* operation,
 	Scope&                scope
 )
 {
-	// Set up the two sides of the logical operation
-	// as well as the resulting boolean
-	Node* leftHand      = operation->GetLeftHand();
-	Node* rightHand     = operation->GetRightHand();
-	BooleanNode* result = nullptr;
+	if (operation->HoistedLoop())
+		return static_cast<BooleanNode*>(_ExecuteHoisted(operation, scope));
+
+	// Set up the two sides of the logical operation,
+	// the result is always one of the shared booleans
+	Node* leftHand  = operation->GetLeftHand();
+	Node* rightHand = operation->GetRightHand();
 
 	// Grab the left hand side from the current scope
 	// checking if this is actually a boolean type will
@@ -2666,6 +4351,8 @@ BooleanNode* Interpreter::_ExecuteLogicalOperation(
 		leftHand = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(leftHand), scope);
 	else if (leftHand->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 		leftHand = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(leftHand), scope);
+	else if (leftHand->Type() == NodeType::MEMBER_IDENTIFIER)
+		leftHand = _GetMember(static_cast<MemberIdentifierNode*>(leftHand), scope);
 	// For now, make sure that the left hand side is a
 	// boolean to check with
 	else if (leftHand->Type() != NodeType::BOOLEAN)
@@ -2695,12 +4382,7 @@ BooleanNode* Interpreter::_ExecuteLogicalOperation(
 	// do not continue, and return false
 	if (operation->Operation() == NodeType::AND && !(static_cast<BooleanNode*>(leftHand)->Value()))
 	{
-		result = new BooleanNode();
-		result->Type(NodeType::BOOLEAN);
-
-		result->Value(false);
-
-		return result;
+		return m_constants.Boolean(false);
 	}
 
 	// Now we grab the right hand side
@@ -2714,6 +4396,8 @@ BooleanNode* Interpreter::_ExecuteLogicalOperation(
 		rightHand = _ExecuteLogicalOperation(static_cast<BinaryOperation*>(rightHand), scope);
 	else if (rightHand->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
 		rightHand = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(rightHand), scope);
+	else if (rightHand->Type() == NodeType::MEMBER_IDENTIFIER)
+		rightHand = _GetMember(static_cast<MemberIdentifierNode*>(rightHand), scope);
 	// For now, check if the right hand type is at least
 	// a boolean for checking
 	else if (rightHand->Type() != NodeType::BOOLEAN)
@@ -2744,168 +4428,1945 @@ BooleanNode* Interpreter::_ExecuteLogicalOperation(
 	// to be true, return a true boolean value
 	if (operation->Operation() == NodeType::AND && static_cast<BooleanNode*>(rightHand)->Value())
 	{
-		result = new BooleanNode();
-		result->Type(NodeType::BOOLEAN);
-
-		result->Value(true);
-
-		return result;
+		return m_constants.Boolean(true);
 	}
 	// Otherwise, if it is false and the operation is an AND, return false
 	else if (operation->Operation() == NodeType::AND && !(static_cast<BooleanNode*>(rightHand)->Value()))
 	{
-		result = new BooleanNode();
-		result->Type(NodeType::BOOLEAN);
-
-		result->Value(false);
-
-		return result;
+		return m_constants.Boolean(false);
 	}
 	// Otherwise, this can be an OR logical operation, and if either of the
 	// values are true, return true
 	else if (operation->Operation() == NodeType::OR && (static_cast<BooleanNode*>(leftHand)->Value() || static_cast<BooleanNode*>(rightHand)->Value()))
 	{
-		result = new BooleanNode();
-		result->Type(NodeType::BOOLEAN);
-
-		result->Value(true);
-
-		return result;
+		return m_constants.Boolean(true);
 	}
 	// Otherwise, the OR has failed, and we can return false
 	else if (operation->Operation() == NodeType::OR)
 	{
-		result = new BooleanNode();
-		result->Type(NodeType::BOOLEAN);
-
-		result->Value(false);
-
-		return result;
+		return m_constants.Boolean(false);
 	}
 
 	return nullptr;
 }
 
-AST::Node* Interpreter::_GetArrayElement(
-	AST::ArrayElementIdentifierNode* identifier,
-	Scope&                           scope
+Node* Interpreter::_ExecuteSubstring(
+	FunctionCall* substring,
+	Scope&        scope
 )
 {
-	// First, try to grab the array
-	// from the string identifier
-	const std::string arrayIdent = identifier->ArrayIdentifier();
-
-	// Try and find this array
-	Node* arrayNode = scope.Search(arrayIdent);
+	const char* name = (substring->Flags() == CallFlags::SLICE) ? "slice" : "substr";
 
-	if (!arrayNode)
+	// Make sure that the call has a string
+	// and both ends of the range
+	if (substring->Arguments().size() != 3)
 	{
-		std::cerr << "Interpreter Error! Undeclared identifier \"" << arrayIdent << "\"!";
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with three arguments!" << std::endl;
+		std::cerr << "Argument amount: " << substring->Arguments().size() << std::endl;
 
 		if (m_errorHandle)
 			m_errorHandle();
-	
+
 		return nullptr;
 	}
 
-	if (arrayNode->Type() != NodeType::ARRAY)
+	bool  temporary = false;
+	Node* value     = _EvaluateArgument(substring->Arguments()[0], scope, temporary);
+
+	if (!value || value->Type() != NodeType::STRING)
 	{
-		std::cerr << "Interpreter Error! Cannot use array access syntax on a non array!" << std::endl;
-		std::cerr << "Actual type: " << GetNodeTypeName(arrayNode->Type()) << std::endl;
+		std::cerr << "Interpreter Error! The \"" << name << "\" call's first argument can only be a string!" << std::endl;
+
+		if (value)
+			std::cerr << "First argument type: " << GetNodeTypeName(value->Type()) << std::endl;
+
+		if (temporary)
+			ReleaseNode(value);
 
 		if (m_errorHandle)
 			m_errorHandle();
+
+		return nullptr;
 	}
 
-	// Now, evaluate the index used
-	// for the identifier
-	Node* index = identifier->Index()->Clone();
-
-	if (index->Type() == NodeType::IDENTIFIER)
-		index = scope.Search(static_cast<IdentifierNode*>(index)->Value())->Clone();
-	else if (index->Type() == NodeType::BINARY_OP)
-		index = _ExecuteBinaryOperation(static_cast<BinaryOperation*>(index), scope);
-	else if (index->Type() == NodeType::LOGICAL_OP)
-		index = _ExecuteLogicalOperation(static_cast<BinaryOperation*>(index), scope);
-	else if (index->Type() == NodeType::CALL)
-		index = _ExecuteFunction(static_cast<FunctionCall*>(index), scope);
-	else if (index->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
-		index = _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(index), scope)->Clone();
+	// Both of the other arguments have to be
+	// integers, evaluate them in order
+	int32_t range[2] = { 0, 0 };
 
-	if (!index)
+	for (size_t index = 0; index < 2; index++)
 	{
-		std::cerr << "Interpreter Error! Undefined index for array access!" << std::endl;
+		bool  rangeTemporary = false;
+		Node* rangeValue     = _EvaluateArgument(substring->Arguments()[index + 1], scope, rangeTemporary);
+
+		if (!rangeValue || rangeValue->Type() != NodeType::INTEGER)
+		{
+			std::cerr << "Interpreter Error! The \"" << name << "\" call's range can only be integers!" << std::endl;
+
+			if (rangeValue)
+				std::cerr << "Range type: " << GetNodeTypeName(rangeValue->Type()) << std::endl;
+
+			if (rangeTemporary)
+				ReleaseNode(rangeValue);
+
+			if (temporary)
+				ReleaseNode(value);
+
+			if (m_errorHandle)
+				m_errorHandle();
+
+			return nullptr;
+		}
+
+		range[index] = static_cast<IntegerNode*>(rangeValue)->Value();
+
+		if (rangeTemporary)
+			ReleaseNode(rangeValue);
+	}
+
+	StringNode* string = static_cast<StringNode*>(value);
+
+	// Slices are given an end rather than a length
+	int32_t start  = range[0];
+	int32_t length = (substring->Flags() == CallFlags::SLICE) ? range[1] - range[0] : range[1];
+
+	if (
+		start < 0  ||
+		length < 0 ||
+		static_cast<size_t>(start) + static_cast<size_t>(length) > string->Length()
+	)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call's range is out of bounds!" << std::endl;
+		std::cerr << "Start: " << range[0] << "; " << ((substring->Flags() == CallFlags::SLICE) ? "End: " : "Length: ") << range[1];
+		std::cerr << "; Size: " << string->Length() << std::endl;
+
+		if (temporary)
+			ReleaseNode(value);
 
 		if (m_errorHandle)
 			m_errorHandle();
+
+		return nullptr;
 	}
 
-	if (index->Type() != NodeType::INTEGER)
+	// The view shares the buffer of the string,
+	// so a temporary string can be released
+	Node* view = string->View(
+		static_cast<size_t>(start),
+		static_cast<size_t>(length)
+	);
+
+	if (temporary)
+		ReleaseNode(value);
+
+	return view;
+}
+
+/**
+ * Find the next separator within a range of characters,
+ * returning nullptr if there isn't one.
+ *
+ * memchr is used to skip to each possible start of the
+ * separator, as it is vectorized by the standard library.
+ */
+static inline const char* FindSeparator(
+	const char* begin,
+	const char* end,
+	const char* separator,
+	size_t      length
+)
+{
+	while (static_cast<size_t>(end - begin) >= length)
 	{
-		std::cerr << "Interpreter Error! Index for array access must be an integer!" << std::endl;
-		std::cerr << "Actual Type: " << GetNodeTypeName(index->Type());
+		const char* find = static_cast<const char*>(
+			std::memchr(begin, separator[0], (end - begin) - length + 1)
+		);
+
+		if (!find)
+			return nullptr;
+
+		if (std::memcmp(find + 1, separator + 1, length - 1) == 0)
+			return find;
+
+		begin = find + 1;
+	}
+
+	return nullptr;
+}
 
-		delete index;
+Node* Interpreter::_ExecuteSplit(
+	FunctionCall* split,
+	Scope&        scope
+)
+{
+	// Make sure that the call only has
+	// the string and the separator
+	if (split->Arguments().size() != 2)
+	{
+		std::cerr << "Interpreter Error! The \"split\" call can only be used with two arguments!" << std::endl;
+		std::cerr << "Argument amount: " << split->Arguments().size() << std::endl;
 
 		if (m_errorHandle)
 			m_errorHandle();
-	}
 
-	// Now, grab the index as a size_t
-	int32_t arrIndex = static_cast<IntegerNode*>(index)->Value();
+		return nullptr;
+	}
 
-	// The index node is no longer needed, delete
-	delete index;
+	bool  temporary          = false;
+	bool  separatorTemporary = false;
+	Node* value              = _EvaluateArgument(split->Arguments()[0], scope, temporary);
+	Node* separatorValue     = _EvaluateArgument(split->Arguments()[1], scope, separatorTemporary);
 
-	// Check if the size is within bounds
-	if (arrIndex < 0 || static_cast<size_t>(arrIndex) >= static_cast<ArrayNode*>(arrayNode)->Size())
+	if (
+		!value          ||
+		!separatorValue ||
+		value->Type()          != NodeType::STRING ||
+		separatorValue->Type() != NodeType::STRING
+	)
 	{
-		std::cerr << "Interpreter Error! Array index out of bounds!" << std::endl;
-		std::cerr << "Index: " << arrIndex << "; Size: " << static_cast<ArrayNode*>(arrayNode)->Size() << std::endl;
-	
+		std::cerr << "Interpreter Error! The \"split\" call can only be used with two strings!" << std::endl;
+
+		if (value && separatorValue)
+		{
+			std::cerr << "First argument type: " << GetNodeTypeName(value->Type()) << ";";
+			std::cerr << " Second argument type: " << GetNodeTypeName(separatorValue->Type()) << std::endl;
+		}
+
+		if (temporary)
+			ReleaseNode(value);
+
+		if (separatorTemporary)
+			ReleaseNode(separatorValue);
+
 		if (m_errorHandle)
 			m_errorHandle();
+
+		return nullptr;
 	}
 
-	// Finally, return the actual node
-	return (*static_cast<ArrayNode*>(arrayNode))[arrIndex];
+	StringNode* string    = static_cast<StringNode*>(value);
+	StringNode* separator = static_cast<StringNode*>(separatorValue);
+
+	const char* begin  = string->Data();
+	const char* end    = begin + string->Length();
+	size_t      length = separator->Length();
+
+	ArrayNode* parts = new ArrayNode();
+	parts->Type(NodeType::ARRAY);
+
+	// An empty separator splits each character
+	// into its own string
+	if (length == 0)
+	{
+		parts->Reserve(string->Length());
+
+		for (size_t index = 0; index < string->Length(); index++)
+			parts->Insert(string->View(index, 1));
+	}
+	else
+	{
+		// Count the separators first, so that the
+		// array is only ever allocated once
+		size_t count = 1;
+
+		for (
+			const char* find = FindSeparator(begin, end, separator->Data(), length);
+			find;
+			find = FindSeparator(find + length, end, separator->Data(), length)
+		)
+			count++;
+
+		parts->Reserve(count);
+
+		// Now, create a view for each part, which
+		// shares the buffer of the string
+		const char* start = begin;
+
+		for (size_t index = 0; index < count; index++)
+		{
+			const char* find = (index + 1 < count) ? FindSeparator(start, end, separator->Data(), length) : end;
+
+			parts->Insert(string->View(start - begin, find - start));
+
+			start = find + length;
+		}
+	}
+
+	// The views share the buffer of the string,
+	// so a temporary string can be released
+	if (temporary)
+		ReleaseNode(value);
+
+	if (separatorTemporary)
+		ReleaseNode(separatorValue);
+
+	return parts;
 }
 
-void Interpreter::_CreateCommandArgumentsArray()
+Node* Interpreter::_ExecuteJoin(
+	FunctionCall* join,
+	Scope&        scope
+)
 {
-	// Shrink the arguments vector before
-	// anything else
-	m_arguments.shrink_to_fit();
+	// Make sure that the call only has
+	// the array and the separator
+	if (join->Arguments().size() != 2)
+	{
+		std::cerr << "Interpreter Error! The \"join\" call can only be used with two arguments!" << std::endl;
+		std::cerr << "Argument amount: " << join->Arguments().size() << std::endl;
 
-	// Create the array node
-	ArrayNode* cmdArgsArray = new ArrayNode();
-	cmdArgsArray->Type(NodeType::ARRAY);
+		if (m_errorHandle)
+			m_errorHandle();
 
-	// Create the capacity for the array
-	IntegerNode* capacity = new IntegerNode();
-	capacity->Type(NodeType::INTEGER);
+		return nullptr;
+	}
 
-	capacity->Value(false, m_arguments.size());
+	bool  temporary          = false;
+	bool  separatorTemporary = false;
+	Node* value              = _EvaluateArgument(join->Arguments()[0], scope, temporary);
+	Node* separatorValue     = _EvaluateArgument(join->Arguments()[1], scope, separatorTemporary);
 
-	capacity->Parent(cmdArgsArray);
+	if (
+		!value          ||
+		!separatorValue ||
+		value->Type()          != NodeType::ARRAY ||
+		separatorValue->Type() != NodeType::STRING
+	)
+	{
+		std::cerr << "Interpreter Error! The \"join\" call can only be used with an array and a string!" << std::endl;
 
-	cmdArgsArray->Fixed(true);
-	cmdArgsArray->Capacity(capacity);
+		if (value && separatorValue)
+		{
+			std::cerr << "First argument type: " << GetNodeTypeName(value->Type()) << ";";
+			std::cerr << " Second argument type: " << GetNodeTypeName(separatorValue->Type()) << std::endl;
+		}
 
-	// Now, fill the array with the
-	// string nodes
-	for (size_t index = 0; index < m_arguments.size(); index++)
-	{
-		StringNode* argument = new StringNode();
-		argument->Type(NodeType::STRING);
+		if (temporary)
+			ReleaseNode(value);
 
-		argument->Value(m_arguments[index]);
+		if (separatorTemporary)
+			ReleaseNode(separatorValue);
 
-		cmdArgsArray->Insert(argument);
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
 	}
 
-	// Now, insert it into global scope with
-	// the reserved array name defined in
-	// the precompiled header
-	m_globalScope.Insert(SHAKARA_CMD_ARGS_NAME, cmdArgsArray);
+	ArrayNode*  elements  = static_cast<ArrayNode*>(value);
+	StringNode* separator = static_cast<StringNode*>(separatorValue);
+
+	// Add up the length of the result first, checking
+	// that every element is a string along the way
+	size_t length = 0;
+
+	for (size_t index = 0; index < elements->Size(); index++)
+	{
+		NodeType elementType = elements->ElementType(index);
+
+		if (elementType != NodeType::STRING)
+		{
+			std::cerr << "Interpreter Error! The \"join\" call can only join an array of strings!" << std::endl;
+			std::cerr << "Element " << index << " type: " << GetNodeTypeName(elementType) << std::endl;
+
+			if (temporary)
+				ReleaseNode(value);
+
+			if (separatorTemporary)
+				ReleaseNode(separatorValue);
+
+			if (m_errorHandle)
+				m_errorHandle();
+
+			return nullptr;
+		}
+
+		length += static_cast<StringNode*>((*elements)[index])->Length();
+
+		if (index > 0)
+			length += separator->Length();
+	}
+
+	// Then write every element into
+	// a single buffer
+	StringNode* result = new StringNode();
+	result->Type(NodeType::STRING);
+	result->Reserve(length);
+
+	for (size_t index = 0; index < elements->Size(); index++)
+	{
+		if (index > 0)
+			result->Append(*separator);
+
+		result->Append(*static_cast<StringNode*>((*elements)[index]));
+	}
+
+	if (temporary)
+		ReleaseNode(value);
+
+	if (separatorTemporary)
+		ReleaseNode(separatorValue);
+
+	return result;
+}
+
+/**
+ * Grab the values of an array of numbers, pointing
+ * straight at the values of a packed array, or copying
+ * the values of a boxed array into the passed in vectors.
+ *
+ * Integers are converted to decimals if decimal is set,
+ * or if a boxed array holds both.
+ *
+ * Returns the type of the values, or the array type if
+ * the array holds anything but numbers.
+ */
+static NodeType NumericValues(
+	ArrayNode*            array,
+	bool                  decimal,
+	std::vector<int32_t>& integers,
+	std::vector<float>&   decimals,
+	const int32_t**       integerValues,
+	const float**         decimalValues
+)
+{
+	if (array->Storage() == ArrayStorage::BOOLEAN)
+		return NodeType::ARRAY;
+
+	if (array->Storage() == ArrayStorage::DECIMAL)
+	{
+		*decimalValues = array->Decimals();
+
+		return NodeType::DECIMAL;
+	}
+
+	if (array->Storage() == ArrayStorage::INTEGER && !decimal)
+	{
+		*integerValues = array->Integers();
+
+		return NodeType::INTEGER;
+	}
+
+	// Otherwise, the values have to be copied, so check
+	// if the copy has to be made as decimals first
+	if (array->Storage() == ArrayStorage::BOXED)
+	{
+		for (size_t index = 0; index < array->Size(); index++)
+		{
+			NodeType type = array->ElementType(index);
+
+			if (type == NodeType::DECIMAL)
+				decimal = true;
+			else if (type != NodeType::INTEGER)
+				return NodeType::ARRAY;
+		}
+	}
+
+	if (!decimal)
+	{
+		integers.reserve(array->Size());
+
+		for (size_t index = 0; index < array->Size(); index++)
+			integers.push_back(static_cast<IntegerNode*>((*array)[index])->Value());
+
+		*integerValues = integers.data();
+
+		return NodeType::INTEGER;
+	}
+
+	decimals.reserve(array->Size());
+
+	for (size_t index = 0; index < array->Size(); index++)
+	{
+		if (array->Storage() == ArrayStorage::INTEGER)
+			decimals.push_back(static_cast<float>(array->Integers()[index]));
+		else if (array->ElementType(index) == NodeType::INTEGER)
+			decimals.push_back(static_cast<float>(static_cast<IntegerNode*>((*array)[index])->Value()));
+		else
+			decimals.push_back(static_cast<DecimalNode*>((*array)[index])->Value());
+	}
+
+	*decimalValues = decimals.data();
+
+	return NodeType::DECIMAL;
+}
+
+Node* Interpreter::_ExecuteArrayReduction(
+	FunctionCall* reduction,
+	Scope&        scope
+)
+{
+	const std::string& name = static_cast<IdentifierNode*>(reduction->Identifier())->Value();
+
+	// Make sure that the call only has the array
+	if (reduction->Arguments().size() != 1)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with one argument!" << std::endl;
+		std::cerr << "Argument amount: " << reduction->Arguments().size() << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	bool  temporary = false;
+	Node* value     = _EvaluateArgument(reduction->Arguments()[0], scope, temporary);
+
+	std::vector<int32_t> integers;
+	std::vector<float>   decimals;
+	const int32_t*       integerValues = nullptr;
+	const float*         decimalValues = nullptr;
+	NodeType             valuesType    = NodeType::ARRAY;
+
+	if (value && value->Type() == NodeType::ARRAY)
+		valuesType = NumericValues(
+			static_cast<ArrayNode*>(value),
+			false,
+			integers,
+			decimals,
+			&integerValues,
+			&decimalValues
+		);
+
+	if (!value || value->Type() != NodeType::ARRAY || valuesType == NodeType::ARRAY)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with an array of integers or decimals!" << std::endl;
+
+		if (temporary)
+			ReleaseNode(value);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	size_t size = static_cast<ArrayNode*>(value)->Size();
+
+	// Only a sum has a value for an empty array
+	if (size == 0 && reduction->Flags() != CallFlags::SUM)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call cannot be used with an empty array!" << std::endl;
+
+		if (temporary)
+			ReleaseNode(value);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	Node* result = nullptr;
+
+	if (valuesType == NodeType::INTEGER)
+	{
+		int32_t integer = 0;
+
+		if (reduction->Flags() == CallFlags::SUM)
+			integer = Kernels::SumIntegers(integerValues, size);
+		else if (reduction->Flags() == CallFlags::MINIMUM)
+			integer = Kernels::MinIntegers(integerValues, size);
+		else
+			integer = Kernels::MaxIntegers(integerValues, size);
+
+		result = m_constants.Integer(integer);
+	}
+	else
+	{
+		float decimal = 0.0f;
+
+		if (reduction->Flags() == CallFlags::SUM)
+			decimal = Kernels::SumDecimals(decimalValues, size);
+		else if (reduction->Flags() == CallFlags::MINIMUM)
+			decimal = Kernels::MinDecimals(decimalValues, size);
+		else
+			decimal = Kernels::MaxDecimals(decimalValues, size);
+
+		DecimalNode* decimalNode = new DecimalNode();
+		decimalNode->Type(NodeType::DECIMAL);
+		decimalNode->Value(false, decimal);
+
+		result = decimalNode;
+	}
+
+	if (temporary)
+		ReleaseNode(value);
+
+	return result;
+}
+
+Node* Interpreter::_ExecuteArrayCombination(
+	FunctionCall* combination,
+	Scope&        scope
+)
+{
+	const std::string& name = static_cast<IdentifierNode*>(combination->Identifier())->Value();
+
+	// Make sure that the call has both sides
+	if (combination->Arguments().size() != 2)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with two arguments!" << std::endl;
+		std::cerr << "Argument amount: " << combination->Arguments().size() << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	bool  leftTemporary  = false;
+	bool  rightTemporary = false;
+	Node* left           = _EvaluateArgument(combination->Arguments()[0], scope, leftTemporary);
+	Node* right          = _EvaluateArgument(combination->Arguments()[1], scope, rightTemporary);
+
+	// Scaling takes a single number on the right hand,
+	// anything else takes another array
+	bool scaling       = combination->Flags() == CallFlags::SCALE;
+	bool rightIsNumber = right && (right->Type() == NodeType::INTEGER || right->Type() == NodeType::DECIMAL);
+
+	if (
+		!left  ||
+		!right ||
+		left->Type() != NodeType::ARRAY ||
+		(scaling && !rightIsNumber)     ||
+		(!scaling && right->Type() != NodeType::ARRAY)
+	)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with an array and " <<
+			((scaling) ? "a number!" : "another array!") << std::endl;
+
+		if (left && right)
+		{
+			std::cerr << "First argument type: " << GetNodeTypeName(left->Type()) << ";";
+			std::cerr << " Second argument type: " << GetNodeTypeName(right->Type()) << std::endl;
+		}
+
+		if (leftTemporary)
+			ReleaseNode(left);
+
+		if (rightTemporary)
+			ReleaseNode(right);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	ArrayNode* leftArray  = static_cast<ArrayNode*>(left);
+	ArrayNode* rightArray = (scaling) ? nullptr : static_cast<ArrayNode*>(right);
+
+	if (rightArray && leftArray->Size() != rightArray->Size())
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with arrays of the same size!" << std::endl;
+		std::cerr << "First size: " << leftArray->Size() << "; Second size: " << rightArray->Size() << std::endl;
+
+		if (leftTemporary)
+			ReleaseNode(left);
+
+		if (rightTemporary)
+			ReleaseNode(right);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	std::vector<int32_t> leftIntegers;
+	std::vector<float>   leftDecimals;
+	std::vector<int32_t> rightIntegers;
+	std::vector<float>   rightDecimals;
+	const int32_t*       leftIntegerValues  = nullptr;
+	const float*         leftDecimalValues  = nullptr;
+	const int32_t*       rightIntegerValues = nullptr;
+	const float*         rightDecimalValues = nullptr;
+
+	// Grab both sides, and if only one of them holds
+	// decimals, grab the other again as decimals
+	NodeType leftType  = NumericValues(leftArray, false, leftIntegers, leftDecimals, &leftIntegerValues, &leftDecimalValues);
+	NodeType rightType = right->Type();
+
+	if (rightArray)
+		rightType = NumericValues(rightArray, false, rightIntegers, rightDecimals, &rightIntegerValues, &rightDecimalValues);
+
+	if (leftType == NodeType::ARRAY || rightType == NodeType::ARRAY)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with arrays of integers or decimals!" << std::endl;
+
+		if (leftTemporary)
+			ReleaseNode(left);
+
+		if (rightTemporary)
+			ReleaseNode(right);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	if (leftType == NodeType::INTEGER && rightType == NodeType::DECIMAL)
+		leftType = NumericValues(leftArray, true, leftIntegers, leftDecimals, &leftIntegerValues, &leftDecimalValues);
+	else if (leftType == NodeType::DECIMAL && rightType == NodeType::INTEGER && rightArray)
+		rightType = NumericValues(rightArray, true, rightIntegers, rightDecimals, &rightIntegerValues, &rightDecimalValues);
+
+	bool   decimal = leftType == NodeType::DECIMAL || rightType == NodeType::DECIMAL;
+	size_t size    = leftArray->Size();
+	Node*  result  = nullptr;
+
+	if (combination->Flags() == CallFlags::DOT)
+	{
+		if (!decimal)
+			result = m_constants.Integer(Kernels::DotIntegers(leftIntegerValues, rightIntegerValues, size));
+		else
+		{
+			DecimalNode* decimalNode = new DecimalNode();
+			decimalNode->Type(NodeType::DECIMAL);
+			decimalNode->Value(false, Kernels::DotDecimals(leftDecimalValues, rightDecimalValues, size));
+
+			result = decimalNode;
+		}
+	}
+	else
+	{
+		// Both of the others create a new array, which
+		// is written to straight from the kernel
+		ArrayNode* resultArray = new ArrayNode();
+		resultArray->Type(NodeType::ARRAY);
+
+		if (!decimal)
+		{
+			std::vector<int32_t> values(size);
+
+			if (scaling)
+				Kernels::ScaleIntegers(leftIntegerValues, static_cast<IntegerNode*>(right)->Value(), values.data(), size);
+			else
+				Kernels::AddIntegers(leftIntegerValues, rightIntegerValues, values.data(), size);
+
+			resultArray->Integers(std::move(values));
+		}
+		else
+		{
+			std::vector<float> values(size);
+
+			if (scaling)
+			{
+				// The factor can still be an integer if only
+				// the array holds decimals
+				float factor = (right->Type() == NodeType::INTEGER) ?
+					static_cast<float>(static_cast<IntegerNode*>(right)->Value()) :
+					static_cast<DecimalNode*>(right)->Value();
+
+				Kernels::ScaleDecimals(leftDecimalValues, factor, values.data(), size);
+			}
+			else
+				Kernels::AddDecimals(leftDecimalValues, rightDecimalValues, values.data(), size);
+
+			resultArray->Decimals(std::move(values));
+		}
+
+		result = resultArray;
+	}
+
+	if (leftTemporary)
+		ReleaseNode(left);
+
+	if (rightTemporary)
+		ReleaseNode(right);
+
+	return result;
+}
+
+/**
+ * Whether a boxed element holds the same value as
+ * another node, which it only can if it is the
+ * same type.
+ */
+static bool ElementEquals(const Node* element, const Node* value)
+{
+	if (element->Type() != value->Type())
+		return false;
+
+	return (element->Type() == NodeType::INTEGER &&
+			static_cast<const IntegerNode*>(element)->Value() == static_cast<const IntegerNode*>(value)->Value()) ||
+		   (element->Type() == NodeType::DECIMAL &&
+			static_cast<const DecimalNode*>(element)->Value() == static_cast<const DecimalNode*>(value)->Value()) ||
+		   (element->Type() == NodeType::BOOLEAN &&
+			static_cast<const BooleanNode*>(element)->Value() == static_cast<const BooleanNode*>(value)->Value()) ||
+		   (element->Type() == NodeType::STRING &&
+			static_cast<const StringNode*>(element)->Equals(*static_cast<const StringNode*>(value)));
+}
+
+Node* Interpreter::_ExecuteCount(
+	FunctionCall* count,
+	Scope&        scope
+)
+{
+	// Make sure that the call only has
+	// the array and the value to count
+	if (count->Arguments().size() != 2)
+	{
+		std::cerr << "Interpreter Error! The \"count\" call can only be used with two arguments!" << std::endl;
+		std::cerr << "Argument amount: " << count->Arguments().size() << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	bool  temporary      = false;
+	bool  valueTemporary = false;
+	Node* collection     = _EvaluateArgument(count->Arguments()[0], scope, temporary);
+	Node* value          = _EvaluateArgument(count->Arguments()[1], scope, valueTemporary);
+
+	if (!collection || !value || collection->Type() != NodeType::ARRAY)
+	{
+		std::cerr << "Interpreter Error! The \"count\" call's first argument can only be an array!" << std::endl;
+
+		if (collection)
+			std::cerr << "First argument type: " << GetNodeTypeName(collection->Type()) << std::endl;
+
+		if (temporary)
+			ReleaseNode(collection);
+
+		if (valueTemporary)
+			ReleaseNode(value);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	ArrayNode* array  = static_cast<ArrayNode*>(collection);
+	size_t     amount = 0;
+
+	// Elements only ever equal a value of the same type,
+	// and packed arrays only hold a single type
+	if (array->Storage() == ArrayStorage::INTEGER && value->Type() == NodeType::INTEGER)
+		amount = Kernels::CountIntegers(array->Integers(), array->Size(), static_cast<IntegerNode*>(value)->Value());
+	else if (array->Storage() == ArrayStorage::DECIMAL && value->Type() == NodeType::DECIMAL)
+		amount = Kernels::CountDecimals(array->Decimals(), array->Size(), static_cast<DecimalNode*>(value)->Value());
+	else if (array->Storage() == ArrayStorage::BOOLEAN && value->Type() == NodeType::BOOLEAN)
+		amount = static_cast<size_t>(std::count(
+			array->Booleans(),
+			array->Booleans() + array->Size(),
+			static_cast<uint8_t>(static_cast<BooleanNode*>(value)->Value())
+		));
+	else if (array->Storage() == ArrayStorage::BOXED)
+	{
+		for (size_t index = 0; index < array->Size(); index++)
+		{
+			if (ElementEquals((*array)[index], value))
+				amount++;
+		}
+	}
+
+	if (temporary)
+		ReleaseNode(collection);
+
+	if (valueTemporary)
+		ReleaseNode(value);
+
+	return m_constants.Integer(static_cast<int32_t>(amount));
+}
+
+Node* Interpreter::_EvaluateArgument(
+	Node*  argument,
+	Scope& scope,
+	bool&  temporary
+)
+{
+	temporary = false;
+
+	if (argument->Type() == NodeType::IDENTIFIER)
+		return scope.Search(static_cast<IdentifierNode*>(argument)->Value());
+	else if (argument->Type() == NodeType::ARRAY_ELEMENT_IDENTIFIER)
+		return _GetArrayElement(static_cast<ArrayElementIdentifierNode*>(argument), scope);
+	else if (argument->Type() == NodeType::MEMBER_IDENTIFIER)
+		return _GetMember(static_cast<MemberIdentifierNode*>(argument), scope);
+
+	// Anything that is executed creates
+	// a new value for the call
+	temporary = true;
+
+	if (argument->Type() == NodeType::CALL)
+		return _ExecuteFunction(static_cast<FunctionCall*>(argument), scope);
+	else if (argument->Type() == NodeType::BINARY_OP)
+		return _ExecuteBinaryOperation(static_cast<BinaryOperation*>(argument), scope);
+	else if (argument->Type() == NodeType::LOGICAL_OP)
+		return _ExecuteLogicalOperation(static_cast<BinaryOperation*>(argument), scope);
+	else if (argument->Type() == NodeType::MAP)
+		return _EvaluateMap(static_cast<MapNode*>(argument), scope);
+
+	// Otherwise, the argument is a literal, and
+	// is read straight from the AST
+	temporary = false;
+
+	return argument;
+}
+
+Node* Interpreter::_ExecuteMapQuery(
+	FunctionCall* query,
+	Scope&        scope
+)
+{
+	const bool   keys = query->Flags() == CallFlags::KEYS;
+	const char*  name = (keys) ? "keys" : "has";
+	const size_t size = (keys) ? 1 : 2;
+
+	// Make sure that the call only has the map,
+	// and the key to look for if checking a key
+	if (query->Arguments().size() != size)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with " << ((keys) ? "one argument!" : "two arguments!") << std::endl;
+		std::cerr << "Argument amount: " << query->Arguments().size() << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	bool  temporary = false;
+	Node* value     = _EvaluateArgument(query->Arguments()[0], scope, temporary);
+
+	if (!value || value->Type() != NodeType::MAP)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call's first argument can only be a map!" << std::endl;
+
+		if (value)
+			std::cerr << "First argument type: " << GetNodeTypeName(value->Type()) << std::endl;
+
+		if (temporary)
+			ReleaseNode(value);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	MapNode* map    = static_cast<MapNode*>(value);
+	Node*    result = nullptr;
+
+	if (keys)
+	{
+		std::vector<Node*> found;
+		map->Keys(found);
+
+		ArrayNode* array = new ArrayNode();
+		array->Type(NodeType::ARRAY);
+		array->Packable(true);
+		array->Reserve(found.size());
+
+		for (size_t index = 0; index < found.size(); index++)
+			array->Insert(m_constants.Share(found[index]));
+
+		result = array;
+	}
+	else
+	{
+		bool  keyTemporary = false;
+		Node* key          = _EvaluateArgument(query->Arguments()[1], scope, keyTemporary);
+
+		result = m_constants.Boolean(key && MapNode::Hashable(key) && map->Find(key));
+
+		if (keyTemporary)
+			ReleaseNode(key);
+	}
+
+	if (temporary)
+		ReleaseNode(value);
+
+	return result;
+}
+
+MapNode* Interpreter::_EvaluateMap(
+	MapNode* definition,
+	Scope&   scope
+)
+{
+	MapNode* map = new MapNode();
+	map->Type(NodeType::MAP);
+
+	for (size_t index = 0; index < definition->Pairs(); index++)
+	{
+		Node* key   = _EvaluateOwned(definition->PairKey(index), scope);
+		Node* value = _EvaluateOwned(definition->PairValue(index), scope);
+
+		if (!key || !value || !MapNode::Hashable(key))
+		{
+			std::cerr << "Interpreter Error! Keys within a map definition must be an integer, decimal, string, or boolean, with a value!" << std::endl;
+
+			if (key)
+				std::cerr << "Key type: " << GetNodeTypeName(key->Type()) << std::endl;
+
+			ReleaseNode(key);
+			ReleaseNode(value);
+
+			if (m_errorHandle)
+				m_errorHandle();
+
+			continue;
+		}
+
+		map->Set(key, value);
+	}
+
+	return map;
+}
+
+Node* Interpreter::_EvaluateOwned(
+	Node*  expression,
+	Scope& scope
+)
+{
+	bool  temporary = false;
+	Node* value     = _EvaluateArgument(expression, scope, temporary);
+
+	if (!value || temporary)
+		return value;
+
+	// Literals are read straight from the AST, so
+	// use the shared constant for them instead
+	if (value == expression)
+		return m_constants.Literal(value);
+
+	return m_constants.Share(value);
+}
+
+Node* Interpreter::_ExecuteHoisted(
+	Node*  expression,
+	Scope& scope
+)
+{
+	WhileStatement* loop = nullptr;
+	size_t          slot = 0;
+
+	if (expression->Type() == NodeType::CALL)
+	{
+		loop = static_cast<FunctionCall*>(expression)->HoistedLoop();
+		slot = static_cast<FunctionCall*>(expression)->HoistedSlot();
+	}
+	else
+	{
+		loop = static_cast<BinaryOperation*>(expression)->HoistedLoop();
+		slot = static_cast<BinaryOperation*>(expression)->HoistedSlot();
+	}
+
+	Node* cached = loop->HoistedValue(slot);
+
+	if (cached)
+	{
+		Node* value = m_constants.Share(cached);
+
+		if (!value->Immortal())
+			value->MarkDelete(cached->MarkedForDeletion());
+
+		return value;
+	}
+
+	// Evaluate the expression the same as if it wasn't
+	// hoisted, which any run of the loop nested within
+	// this evaluation does as well
+	if (expression->Type() == NodeType::CALL)
+		static_cast<FunctionCall*>(expression)->Hoist(nullptr, slot);
+	else
+		static_cast<BinaryOperation*>(expression)->Hoist(nullptr, slot);
+
+	bool  temporary = false;
+	Node* value     = _EvaluateArgument(expression, scope, temporary);
+
+	if (expression->Type() == NodeType::CALL)
+		static_cast<FunctionCall*>(expression)->Hoist(loop, slot);
+	else
+		static_cast<BinaryOperation*>(expression)->Hoist(loop, slot);
+
+	// Anything that failed is evaluated again next time,
+	// so that it is reported the same as before
+	if (value)
+	{
+		cached = m_constants.Share(value);
+
+		if (!cached->Immortal())
+			cached->MarkDelete(value->MarkedForDeletion());
+
+		loop->HoistedValue(slot) = cached;
+	}
+
+	return value;
+}
+
+AST::Node* Interpreter::_GetArrayElement(
+	AST::ArrayElementIdentifierNode* identifier,
+	Scope&                           scope
+)
+{
+	// First, try to grab the array
+	// from the string identifier
+	const std::string arrayIdent = identifier->ArrayIdentifier();
+
+	// Try and find this array
+	Node* arrayNode = scope.Search(arrayIdent);
+
+	if (!arrayNode)
+	{
+		std::cerr << "Interpreter Error! Undeclared identifier \"" << arrayIdent << "\"!";
+
+		if (m_errorHandle)
+			m_errorHandle();
+	
+		return nullptr;
+	}
+
+	// Indices proven to be within bounds are always an
+	// integer variable, so skip evaluating and checking it
+	if (identifier->InBounds() && arrayNode->Type() == NodeType::ARRAY)
+	{
+		IntegerNode* index = static_cast<IntegerNode*>(scope.Search(static_cast<IdentifierNode*>(identifier->Index())->Value()));
+
+		return _LoadElement(static_cast<ArrayNode*>(arrayNode), static_cast<size_t>(index->Value()));
+	}
+
+	// Matrices are accessed with both a row and a
+	// column, and only hold decimals
+	if (arrayNode->Type() == NodeType::MATRIX)
+	{
+		MatrixNode* matrix = static_cast<MatrixNode*>(arrayNode);
+		size_t      offset = 0;
+
+		if (!_GetMatrixOffset(matrix, identifier, scope, offset))
+			return nullptr;
+
+		DecimalNode* decimal = new DecimalNode();
+		decimal->Type(NodeType::DECIMAL);
+		decimal->Value(false, matrix->Values()[offset]);
+
+		m_loaded.push_back(decimal);
+
+		return decimal;
+	}
+
+	if (identifier->Column())
+	{
+		std::cerr << "Interpreter Error! Only a matrix can be accessed with both a row and a column!" << std::endl;
+		std::cerr << "Actual type: " << GetNodeTypeName(arrayNode->Type()) << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	// Maps are accessed with a key of any single
+	// value type, rather than an index
+	if (arrayNode->Type() == NodeType::MAP)
+	{
+		bool  temporary = false;
+		Node* key       = _EvaluateArgument(identifier->Index(), scope, temporary);
+		Node* value     = (key && MapNode::Hashable(key)) ? static_cast<MapNode*>(arrayNode)->Find(key) : nullptr;
+
+		if (temporary)
+			ReleaseNode(key);
+
+		if (!value)
+		{
+			std::cerr << "Interpreter Error! Key does not exist within the map \"" << arrayIdent << "\"!" << std::endl;
+
+			if (m_errorHandle)
+				m_errorHandle();
+		}
+
+		return value;
+	}
+
+	if (arrayNode->Type() != NodeType::ARRAY)
+	{
+		std::cerr << "Interpreter Error! Cannot use array access syntax on a non array!" << std::endl;
+		std::cerr << "Actual type: " << GetNodeTypeName(arrayNode->Type()) << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+	}
+
+	// Now, evaluate the index used
+	// for the identifier
+	Node* index = _EvaluateOwned(identifier->Index(), scope);
+
+	if (!index)
+	{
+		std::cerr << "Interpreter Error! Undefined index for array access!" << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+	}
+
+	if (index->Type() != NodeType::INTEGER)
+	{
+		std::cerr << "Interpreter Error! Index for array access must be an integer!" << std::endl;
+		std::cerr << "Actual Type: " << GetNodeTypeName(index->Type());
+
+		ReleaseNode(index);
+
+		if (m_errorHandle)
+			m_errorHandle();
+	}
+
+	// Now, grab the index as a size_t
+	int32_t arrIndex = static_cast<IntegerNode*>(index)->Value();
+
+	// The index node is no longer needed, delete
+	ReleaseNode(index);
+
+	// Check if the size is within bounds
+	if (arrIndex < 0 || static_cast<size_t>(arrIndex) >= static_cast<ArrayNode*>(arrayNode)->Size())
+	{
+		std::cerr << "Interpreter Error! Array index out of bounds!" << std::endl;
+		std::cerr << "Index: " << arrIndex << "; Size: " << static_cast<ArrayNode*>(arrayNode)->Size() << std::endl;
+	
+		if (m_errorHandle)
+			m_errorHandle();
+	}
+
+	// Finally, return the actual node
+	return _LoadElement(static_cast<ArrayNode*>(arrayNode), static_cast<size_t>(arrIndex));
+}
+
+Node* Interpreter::_LoadElement(
+	ArrayNode* array,
+	size_t     index
+)
+{
+	Node* element = nullptr;
+
+	// Pooled values can be used as is, while anything
+	// else is created and kept until the statement
+	// is done executing
+	switch (array->Storage())
+	{
+	case ArrayStorage::INTEGER:
+	{
+		element = m_constants.Integer(array->Integers()[index]);
+
+		break;
+	}
+	case ArrayStorage::DECIMAL:
+	{
+		DecimalNode* decimal = new DecimalNode();
+		decimal->Type(NodeType::DECIMAL);
+		decimal->Value(false, array->Decimals()[index]);
+
+		element = decimal;
+
+		break;
+	}
+	case ArrayStorage::BOOLEAN:
+		return m_constants.Boolean(array->Booleans()[index] != 0);
+	default:
+		return (*array)[index];
+	}
+
+	if (!element->Immortal())
+		m_loaded.push_back(element);
+
+	return element;
+}
+
+void Interpreter::_ReleaseLoaded(size_t amount)
+{
+	while (m_loaded.size() > amount)
+	{
+		ReleaseNode(m_loaded.back());
+
+		m_loaded.pop_back();
+	}
+}
+
+void Interpreter::_CreateCommandArgumentsArray()
+{
+	// Shrink the arguments vector before
+	// anything else
+	m_arguments.shrink_to_fit();
+
+	// Create the array node
+	ArrayNode* cmdArgsArray = new ArrayNode();
+	cmdArgsArray->Type(NodeType::ARRAY);
+
+	// Grab the capacity for the array
+	IntegerNode* capacity = m_constants.Integer(static_cast<int32_t>(m_arguments.size()));
+
+	cmdArgsArray->Fixed(true);
+	cmdArgsArray->Capacity(capacity);
+	cmdArgsArray->Reserve(m_arguments.size());
+
+	// Now, fill the array with the
+	// string nodes
+	for (size_t index = 0; index < m_arguments.size(); index++)
+	{
+		StringNode* argument = new StringNode();
+		argument->Type(NodeType::STRING);
+
+		argument->Value(m_arguments[index]);
+
+		cmdArgsArray->Insert(argument);
+	}
+
+	// Now, insert it into global scope with
+	// the reserved array name defined in
+	// the precompiled header
+	m_globalScope.Insert(SHAKARA_CMD_ARGS_NAME, cmdArgsArray);
+}
+
+/**
+ * Order two boxed elements of the same kind, either
+ * two strings, or two numbers of either type.
+ */
+static bool ElementBefore(const Node* left, const Node* right)
+{
+	if (left->Type() == NodeType::STRING)
+	{
+		const StringNode* leftString  = static_cast<const StringNode*>(left);
+		const StringNode* rightString = static_cast<const StringNode*>(right);
+
+		int compared = std::memcmp(
+			leftString->Data(),
+			rightString->Data(),
+			std::min(leftString->Length(), rightString->Length())
+		);
+
+		return compared < 0 || (compared == 0 && leftString->Length() < rightString->Length());
+	}
+
+	if (left->Type() == NodeType::INTEGER && right->Type() == NodeType::INTEGER)
+		return static_cast<const IntegerNode*>(left)->Value() < static_cast<const IntegerNode*>(right)->Value();
+
+	float leftValue  = (left->Type() == NodeType::INTEGER) ?
+		static_cast<float>(static_cast<const IntegerNode*>(left)->Value()) :
+		static_cast<const DecimalNode*>(left)->Value();
+	float rightValue = (right->Type() == NodeType::INTEGER) ?
+		static_cast<float>(static_cast<const IntegerNode*>(right)->Value()) :
+		static_cast<const DecimalNode*>(right)->Value();
+
+	return leftValue < rightValue || (leftValue == leftValue && rightValue != rightValue);
+}
+
+Node* Interpreter::_ExecuteSort(
+	FunctionCall* sort,
+	Scope&        scope
+)
+{
+	const bool  descending = sort->Flags() == CallFlags::SORT_DESCENDING;
+	const char* name       = (descending) ? "sort_desc" : "sort";
+
+	// Make sure that the call has the array, and
+	// whether to keep the order of equal elements
+	if (sort->Arguments().size() != 1 && sort->Arguments().size() != 2)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with one or two arguments!" << std::endl;
+		std::cerr << "Argument amount: " << sort->Arguments().size() << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	bool  temporary       = false;
+	bool  stableTemporary = false;
+	Node* collection      = _EvaluateArgument(sort->Arguments()[0], scope, temporary);
+	Node* stable          = (sort->Arguments().size() == 2) ?
+		_EvaluateArgument(sort->Arguments()[1], scope, stableTemporary) :
+		m_constants.Boolean(false);
+
+	if (
+		!collection ||
+		!stable     ||
+		collection->Type() != NodeType::ARRAY ||
+		stable->Type() != NodeType::BOOLEAN
+	)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with an array, and optionally a boolean!" << std::endl;
+
+		if (collection && stable)
+		{
+			std::cerr << "First argument type: " << GetNodeTypeName(collection->Type()) << ";";
+			std::cerr << " Second argument type: " << GetNodeTypeName(stable->Type()) << std::endl;
+		}
+
+		if (temporary)
+			ReleaseNode(collection);
+
+		if (stableTemporary)
+			ReleaseNode(stable);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	ArrayNode* array  = static_cast<ArrayNode*>(collection);
+	size_t     size   = array->Size();
+	bool       keep   = static_cast<BooleanNode*>(stable)->Value();
+	ArrayNode* result = new ArrayNode();
+	result->Type(NodeType::ARRAY);
+
+	if (stableTemporary)
+		ReleaseNode(stable);
+
+	// Packed values can't be told apart when they are
+	// equal, so they never need a stable sort
+	if (array->Storage() == ArrayStorage::INTEGER)
+	{
+		std::vector<int32_t> values(array->Integers(), array->Integers() + size);
+
+		Kernels::SortIntegers(values.data(), size, descending);
+
+		result->Integers(std::move(values));
+	}
+	else if (array->Storage() == ArrayStorage::DECIMAL)
+	{
+		std::vector<float> values(array->Decimals(), array->Decimals() + size);
+
+		Kernels::SortDecimals(values.data(), size, descending);
+
+		result->Decimals(std::move(values));
+	}
+	else if (array->Storage() == ArrayStorage::BOOLEAN)
+	{
+		// Only two values, so counting is enough
+		size_t falses = static_cast<size_t>(std::count(array->Booleans(), array->Booleans() + size, 0));
+
+		std::vector<uint8_t> values(size, (descending) ? 0 : 1);
+
+		if (descending)
+			std::fill(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(size - falses), 1);
+		else
+			std::fill(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(falses), 0);
+
+		result->Booleans(std::move(values));
+	}
+	else
+	{
+		// Boxed elements can only be ordered if they
+		// are all strings, or all numbers
+		std::vector<Node*> elements;
+		elements.reserve(size);
+
+		bool strings = size > 0 && array->ElementType(0) == NodeType::STRING;
+
+		for (size_t index = 0; index < size; index++)
+		{
+			Node* element = (*array)[index];
+
+			bool number = element->Type() == NodeType::INTEGER || element->Type() == NodeType::DECIMAL;
+
+			if ((strings && element->Type() != NodeType::STRING) || (!strings && !number))
+			{
+				std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with an array of all numbers, or all strings!" << std::endl;
+				std::cerr << "Element type: " << GetNodeTypeName(element->Type()) << std::endl;
+
+				delete result;
+
+				if (temporary)
+					ReleaseNode(collection);
+
+				if (m_errorHandle)
+					m_errorHandle();
+
+				return nullptr;
+			}
+
+			elements.push_back(element);
+		}
+
+		auto before = [descending](const Node* left, const Node* right) {
+			return (descending) ? ElementBefore(right, left) : ElementBefore(left, right);
+		};
+
+		if (keep)
+			std::stable_sort(elements.begin(), elements.end(), before);
+		else
+			std::sort(elements.begin(), elements.end(), before);
+
+		result->Packable(true);
+		result->Reserve(size);
+
+		for (size_t index = 0; index < size; index++)
+			result->Insert(m_constants.Share(elements[index]));
+	}
+
+	if (temporary)
+		ReleaseNode(collection);
+
+	return result;
+}
+
+/**
+ * Whether two nodes can be ordered against each
+ * other, being either two strings or two numbers.
+ */
+static bool Comparable(const Node* left, const Node* right)
+{
+	if (left->Type() == NodeType::STRING || right->Type() == NodeType::STRING)
+		return left->Type() == right->Type();
+
+	return (left->Type() == NodeType::INTEGER || left->Type() == NodeType::DECIMAL) &&
+		   (right->Type() == NodeType::INTEGER || right->Type() == NodeType::DECIMAL);
+}
+
+/**
+ * Grab the index of the first of a sorted run of
+ * packed values that isn't before the value, and
+ * whether the value is found there.
+ */
+template <typename T, typename V>
+static size_t PackedLowerBound(const T* values, size_t size, V value, bool& found)
+{
+	const T* bound = std::lower_bound(values, values + size, value, [](T element, V compared) {
+		return static_cast<V>(element) < compared;
+	});
+
+	size_t index = static_cast<size_t>(bound - values);
+
+	found = index < size && !(value < static_cast<V>(values[index]));
+
+	return index;
+}
+
+Node* Interpreter::_ExecuteSearch(
+	FunctionCall* search,
+	Scope&        scope
+)
+{
+	const char* name = "index_of";
+
+	if (search->Flags() == CallFlags::BINARY_SEARCH)
+		name = "bsearch";
+	else if (search->Flags() == CallFlags::LOWER_BOUND)
+		name = "lower_bound";
+
+	// Make sure that the call only has
+	// the array and the value to find
+	if (search->Arguments().size() != 2)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with two arguments!" << std::endl;
+		std::cerr << "Argument amount: " << search->Arguments().size() << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	bool  temporary      = false;
+	bool  valueTemporary = false;
+	Node* collection     = _EvaluateArgument(search->Arguments()[0], scope, temporary);
+	Node* value          = _EvaluateArgument(search->Arguments()[1], scope, valueTemporary);
+
+	if (!collection || !value || collection->Type() != NodeType::ARRAY)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call's first argument can only be an array!" << std::endl;
+
+		if (collection)
+			std::cerr << "First argument type: " << GetNodeTypeName(collection->Type()) << std::endl;
+
+		if (temporary)
+			ReleaseNode(collection);
+
+		if (valueTemporary)
+			ReleaseNode(value);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	ArrayNode* array = static_cast<ArrayNode*>(collection);
+	size_t     size  = array->Size();
+	size_t     index = size;
+	bool       found = false;
+	bool       valid = true;
+
+	if (search->Flags() == CallFlags::INDEX_OF)
+	{
+		// Elements only ever equal a value of the same type,
+		// and packed arrays only hold a single type
+		if (array->Storage() == ArrayStorage::INTEGER && value->Type() == NodeType::INTEGER)
+			index = Kernels::IndexOfIntegers(array->Integers(), size, static_cast<IntegerNode*>(value)->Value());
+		else if (array->Storage() == ArrayStorage::DECIMAL && value->Type() == NodeType::DECIMAL)
+			index = Kernels::IndexOfDecimals(array->Decimals(), size, static_cast<DecimalNode*>(value)->Value());
+		else if (array->Storage() == ArrayStorage::BOOLEAN && value->Type() == NodeType::BOOLEAN)
+			index = static_cast<size_t>(std::find(
+				array->Booleans(),
+				array->Booleans() + size,
+				static_cast<uint8_t>(static_cast<BooleanNode*>(value)->Value())
+			) - array->Booleans());
+		else if (array->Storage() == ArrayStorage::BOXED)
+		{
+			for (index = 0; index < size; index++)
+				if (ElementEquals((*array)[index], value))
+					break;
+		}
+
+		found = index < size;
+	}
+	// Otherwise, the array is expected to be sorted smallest
+	// first, so the value can be found by halving the range
+	else if (array->Storage() == ArrayStorage::INTEGER && value->Type() == NodeType::INTEGER)
+		index = PackedLowerBound(array->Integers(), size, static_cast<IntegerNode*>(value)->Value(), found);
+	else if (array->Storage() == ArrayStorage::INTEGER && value->Type() == NodeType::DECIMAL)
+		index = PackedLowerBound(array->Integers(), size, static_cast<DecimalNode*>(value)->Value(), found);
+	else if (array->Storage() == ArrayStorage::DECIMAL && value->Type() == NodeType::DECIMAL)
+		index = PackedLowerBound(array->Decimals(), size, static_cast<DecimalNode*>(value)->Value(), found);
+	else if (array->Storage() == ArrayStorage::DECIMAL && value->Type() == NodeType::INTEGER)
+		index = PackedLowerBound(array->Decimals(), size, static_cast<float>(static_cast<IntegerNode*>(value)->Value()), found);
+	else if (array->Storage() == ArrayStorage::BOOLEAN && value->Type() == NodeType::BOOLEAN)
+		index = PackedLowerBound(array->Booleans(), size, static_cast<uint8_t>(static_cast<BooleanNode*>(value)->Value()), found);
+	else if (array->Storage() == ArrayStorage::BOXED)
+	{
+		size_t low  = 0;
+		size_t high = size;
+
+		while (low < high && valid)
+		{
+			size_t middle  = low + (high - low) / 2;
+			Node*  element = (*array)[middle];
+
+			valid = Comparable(element, value);
+
+			if (valid && ElementBefore(element, value))
+				low = middle + 1;
+			else
+				high = middle;
+		}
+
+		index = low;
+		found = valid && index < size && !ElementBefore(value, (*array)[index]);
+	}
+	else
+		valid = size == 0;
+
+	if (!valid)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can't compare the value to the elements of the array!" << std::endl;
+		std::cerr << "Value type: " << GetNodeTypeName(value->Type()) << std::endl;
+
+		if (temporary)
+			ReleaseNode(collection);
+
+		if (valueTemporary)
+			ReleaseNode(value);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	if (temporary)
+		ReleaseNode(collection);
+
+	if (valueTemporary)
+		ReleaseNode(value);
+
+	// A lower bound can be one past the end, while
+	// the others give -1 when the value isn't found
+	if (search->Flags() == CallFlags::LOWER_BOUND)
+		return m_constants.Integer(static_cast<int32_t>(index));
+
+	return m_constants.Integer((found) ? static_cast<int32_t>(index) : -1);
+}
+
+bool Interpreter::_GetMatrixOffset(
+	MatrixNode*                 matrix,
+	ArrayElementIdentifierNode* identifier,
+	Scope&                      scope,
+	size_t&                     offset
+)
+{
+	if (!identifier->Column())
+	{
+		std::cerr << "Interpreter Error! An element of matrix \"" << identifier->ArrayIdentifier() << "\" needs both a row and a column!" << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return false;
+	}
+
+	bool  rowTemporary    = false;
+	bool  columnTemporary = false;
+	Node* row             = _EvaluateArgument(identifier->Index(), scope, rowTemporary);
+	Node* column          = _EvaluateArgument(identifier->Column(), scope, columnTemporary);
+
+	bool valid = row && column && row->Type() == NodeType::INTEGER && column->Type() == NodeType::INTEGER;
+
+	int32_t rowIndex    = (valid) ? static_cast<IntegerNode*>(row)->Value() : 0;
+	int32_t columnIndex = (valid) ? static_cast<IntegerNode*>(column)->Value() : 0;
+
+	if (rowTemporary)
+		ReleaseNode(row);
+
+	if (columnTemporary)
+		ReleaseNode(column);
+
+	if (!valid)
+	{
+		std::cerr << "Interpreter Error! Row and column for matrix access must be integers!" << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return false;
+	}
+
+	if (
+		rowIndex < 0 || static_cast<size_t>(rowIndex) >= matrix->Rows() ||
+		columnIndex < 0 || static_cast<size_t>(columnIndex) >= matrix->Columns()
+	)
+	{
+		std::cerr << "Interpreter Error! Matrix index out of bounds!" << std::endl;
+		std::cerr << "Row: " << rowIndex << "; Column: " << columnIndex << "; ";
+		std::cerr << "Size: " << matrix->Rows() << "x" << matrix->Columns() << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return false;
+	}
+
+	offset = static_cast<size_t>(rowIndex) * matrix->Columns() + static_cast<size_t>(columnIndex);
+
+	return true;
+}
+
+Node* Interpreter::_ExecuteMatrix(
+	FunctionCall* matrix,
+	Scope&        scope
+)
+{
+	// Make sure that the call has the size,
+	// and optionally the values to fill it with
+	if (matrix->Arguments().size() != 2 && matrix->Arguments().size() != 3)
+	{
+		std::cerr << "Interpreter Error! The \"matrix\" call can only be used with two or three arguments!" << std::endl;
+		std::cerr << "Argument amount: " << matrix->Arguments().size() << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	bool  rowsTemporary    = false;
+	bool  columnsTemporary = false;
+	bool  valuesTemporary  = false;
+	Node* rows             = _EvaluateArgument(matrix->Arguments()[0], scope, rowsTemporary);
+	Node* columns          = _EvaluateArgument(matrix->Arguments()[1], scope, columnsTemporary);
+	Node* values           = (matrix->Arguments().size() == 3) ?
+		_EvaluateArgument(matrix->Arguments()[2], scope, valuesTemporary) :
+		nullptr;
+
+	bool valid =
+		rows && columns &&
+		rows->Type() == NodeType::INTEGER && columns->Type() == NodeType::INTEGER &&
+		static_cast<IntegerNode*>(rows)->Value() >= 0 && static_cast<IntegerNode*>(columns)->Value() >= 0 &&
+		(matrix->Arguments().size() == 2 || (values && values->Type() == NodeType::ARRAY));
+
+	size_t rowCount    = (valid) ? static_cast<size_t>(static_cast<IntegerNode*>(rows)->Value()) : 0;
+	size_t columnCount = (valid) ? static_cast<size_t>(static_cast<IntegerNode*>(columns)->Value()) : 0;
+
+	if (rowsTemporary)
+		ReleaseNode(rows);
+
+	if (columnsTemporary)
+		ReleaseNode(columns);
+
+	if (!valid)
+	{
+		std::cerr << "Interpreter Error! The \"matrix\" call can only be used with a positive amount of rows and columns, and optionally an array!" << std::endl;
+
+		if (valuesTemporary)
+			ReleaseNode(values);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	MatrixNode* result = new MatrixNode();
+	result->Type(NodeType::MATRIX);
+
+	if (!values)
+	{
+		result->Shape(rowCount, columnCount);
+
+		return result;
+	}
+
+	ArrayNode*           array         = static_cast<ArrayNode*>(values);
+	std::vector<int32_t> integers;
+	std::vector<float>   decimals;
+	const int32_t*       integerValues = nullptr;
+	const float*         decimalValues = nullptr;
+
+	NodeType valuesType = NumericValues(array, true, integers, decimals, &integerValues, &decimalValues);
+
+	if (valuesType == NodeType::ARRAY || array->Size() != rowCount * columnCount)
+	{
+		std::cerr << "Interpreter Error! The \"matrix\" call's values must be an array of integers or decimals, with one for each element!" << std::endl;
+		std::cerr << "Elements: " << rowCount * columnCount << "; Values: " << array->Size() << std::endl;
+
+		delete result;
+
+		if (valuesTemporary)
+			ReleaseNode(values);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	result->Values(rowCount, columnCount, std::vector<float>(decimalValues, decimalValues + array->Size()));
+
+	if (valuesTemporary)
+		ReleaseNode(values);
+
+	return result;
+}
+
+Node* Interpreter::_ExecuteMatrixOperation(
+	FunctionCall* operation,
+	Scope&        scope
+)
+{
+	const std::string& name     = static_cast<IdentifierNode*>(operation->Identifier())->Value();
+	const bool         multiply = operation->Flags() == CallFlags::MATRIX_MULTIPLY;
+	const size_t       size     = (multiply) ? 2 : 1;
+
+	// Make sure that the call only has the matrix,
+	// or both matrices if multiplying
+	if (operation->Arguments().size() != size)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with " << ((multiply) ? "two arguments!" : "one argument!") << std::endl;
+		std::cerr << "Argument amount: " << operation->Arguments().size() << std::endl;
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	bool  leftTemporary  = false;
+	bool  rightTemporary = false;
+	Node* left           = _EvaluateArgument(operation->Arguments()[0], scope, leftTemporary);
+	Node* right          = (multiply) ? _EvaluateArgument(operation->Arguments()[1], scope, rightTemporary) : nullptr;
+
+	if (
+		!left || left->Type() != NodeType::MATRIX ||
+		(multiply && (!right || right->Type() != NodeType::MATRIX))
+	)
+	{
+		std::cerr << "Interpreter Error! The \"" << name << "\" call can only be used with " << ((multiply) ? "two matrices!" : "a matrix!") << std::endl;
+
+		if (left)
+			std::cerr << "First argument type: " << GetNodeTypeName(left->Type()) << std::endl;
+
+		if (leftTemporary)
+			ReleaseNode(left);
+
+		if (rightTemporary)
+			ReleaseNode(right);
+
+		if (m_errorHandle)
+			m_errorHandle();
+
+		return nullptr;
+	}
+
+	MatrixNode* matrix  = static_cast<MatrixNode*>(left);
+	size_t      rows    = matrix->Rows();
+	size_t      columns = matrix->Columns();
+	Node*       result  = nullptr;
+
+	if (multiply)
+	{
+		MatrixNode* other = static_cast<MatrixNode*>(right);
+
+		if (columns != other->Rows())
+		{
+			std::cerr << "Interpreter Error! The \"matmul\" call needs the columns of the first matrix to match the rows of the second!" << std::endl;
+			std::cerr << "First size: " << rows << "x" << columns << "; Second size: " << other->Rows() << "x" << other->Columns() << std::endl;
+
+			if (leftTemporary)
+				ReleaseNode(left);
+
+			if (rightTemporary)
+				ReleaseNode(right);
+
+			if (m_errorHandle)
+				m_errorHandle();
+
+			return nullptr;
+		}
+
+		std::vector<float> values(rows * other->Columns());
+
+		Kernels::MultiplyMatrices(matrix->Values(), other->Values(), values.data(), rows, columns, other->Columns());
+
+		MatrixNode* product = new MatrixNode();
+		product->Type(NodeType::MATRIX);
+		product->Values(rows, other->Columns(), std::move(values));
+
+		result = product;
+	}
+	else if (operation->Flags() == CallFlags::TRANSPOSE)
+	{
+		std::vector<float> values(rows * columns);
+
+		Kernels::TransposeMatrix(matrix->Values(), values.data(), rows, columns);
+
+		MatrixNode* transposed = new MatrixNode();
+		transposed->Type(NodeType::MATRIX);
+		transposed->Values(columns, rows, std::move(values));
+
+		result = transposed;
+	}
+	else if (
+		operation->Flags() == CallFlags::ROW_SUMS ||
+		operation->Flags() == CallFlags::COLUMN_SUMS
+	)
+	{
+		bool               byRow = operation->Flags() == CallFlags::ROW_SUMS;
+		std::vector<float> values((byRow) ? rows : columns);
+
+		if (byRow)
+			Kernels::SumRows(matrix->Values(), values.data(), rows, columns);
+		else
+			Kernels::SumColumns(matrix->Values(), values.data(), rows, columns);
+
+		ArrayNode* sums = new ArrayNode();
+		sums->Type(NodeType::ARRAY);
+		sums->Decimals(std::move(values));
+
+		result = sums;
+	}
+	else
+		result = m_constants.Integer(static_cast<int32_t>((operation->Flags() == CallFlags::ROWS) ? rows : columns));
+
+	if (leftTemporary)
+		ReleaseNode(left);
+
+	if (rightTemporary)
+		ReleaseNode(right);
+
+	return result;
 }
\ No newline at end of file
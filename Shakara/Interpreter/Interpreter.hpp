@@ -1,5 +1,8 @@
 #pragma once
 
+#include "ConstantPool.hpp"
+#include "MemoTable.hpp"
+
 namespace std
 {
 	class cout;
@@ -23,6 +26,8 @@ namespace Shakara
 
 		class WhileStatement;
 
+		class ForStatement;
+
 		class BooleanNode;
 
 		class IfStatement;
@@ -30,8 +35,29 @@ namespace Shakara
 		class ArrayNode;
 
 		class ArrayElementIdentifierNode;
+
+		class MapNode;
+
+		class StructDeclaration;
+
+		class StructNode;
+
+		class MemberIdentifierNode;
+
+		class MatrixNode;
 	}
 
+	/**
+	 * How the body of a loop was left, other than
+	 * by running out of statements or returning.
+	 */
+	enum class LoopControl : uint8_t
+	{
+		NONE     = 0x00,
+		BREAK    = 0x01,
+		CONTINUE = 0x02
+	};
+
 	/**
 	 * A structure containing a map of variables to identifiers,
 	 * as well as a parent scope.
@@ -44,8 +70,21 @@ namespace Shakara
 		Scope*                                  parent = nullptr;
 		std::map<const std::string, AST::Node*> variables;
 
+		/**
+		 * The struct instance a member function was
+		 * called on, whose fields can be used as if
+		 * they were variables within its body.
+		 */
+		AST::StructNode*                        receiver = nullptr;
+
 		~Scope();
 
+		/**
+		 * Release each variable marked for deletion,
+		 * and empty the scope so it can be used again.
+		 */
+		void Release();
+
 		/**
 		 * Attempt to insert a node into the current scope.
 		 *
@@ -63,6 +102,20 @@ namespace Shakara
 
 		AST::Node* Search(const std::string& identifier);
 
+		/**
+		 * Grab where the value of a variable is held,
+		 * searching the same as Search does, so that
+		 * the value can be replaced in place.
+		 */
+		AST::Node** Slot(const std::string& identifier);
+
+		/**
+		 * Attempt to update a field of the receiver,
+		 * if it has one by the name and it isn't
+		 * hidden by a variable.
+		 */
+		bool _UpdateField(const std::string& identifier, AST::Node* node);
+
 		AST::Node* operator[](const std::string& identifier)
 		{
 			return variables[identifier];
@@ -72,6 +125,26 @@ namespace Shakara
 	class Interpreter
 	{
 	public:
+		/**
+		 * The deepest calls are allowed to nest by
+		 * default, before an error is reported.
+		 */
+		static const size_t DEFAULT_MAX_DEPTH = 1 << 20;
+
+		/**
+		 * How much of the stack calls may use before the
+		 * next call is moved onto a new stack segment, and
+		 * the size of each segment.
+		 *
+		 * The size of the stack of whoever is executing
+		 * isn't known, so only a little of it is used,
+		 * while each segment leaves room for the last
+		 * call on it to nest statements and expressions.
+		 */
+		static const size_t FIRST_STACK_USE    = 256 * 1024;
+		static const size_t SEGMENT_STACK_SIZE = 64 * 1024 * 1024;
+		static const size_t SEGMENT_STACK_USE  = SEGMENT_STACK_SIZE - 1024 * 1024;
+
 		Interpreter();
 
 		Interpreter(std::ostream& output);
@@ -81,6 +154,38 @@ namespace Shakara
 			m_errorHandle = handler;
 		}
 
+		/**
+		 * Set how deep calls are allowed to nest, calls
+		 * in tail position not counting towards it.
+		 */
+		inline void MaxDepth(size_t depth)
+		{
+			m_maxDepth = depth;
+		}
+
+		inline size_t MaxDepth() const
+		{
+			return m_maxDepth;
+		}
+
+		/**
+		 * Set whether the values returned by pure
+		 * functions are remembered for each set of
+		 * arguments, rather than calling them again.
+		 *
+		 * Only calls with integers, decimals, strings,
+		 * and booleans as arguments are remembered.
+		 */
+		inline void Memoize(bool state)
+		{
+			m_memoize = state;
+		}
+
+		inline bool Memoize() const
+		{
+			return m_memoize;
+		}
+
 		/**
 		 * Pass in a AST root to start interpreting
 		 * and actually executing code.
@@ -123,10 +228,77 @@ namespace Shakara
 		 */
 		std::function<void()> m_errorHandle;
 
+		/**
+		 * Shared values used instead of allocating
+		 * new nodes for common values.
+		 *
+		 * Declared before the global scope, as it
+		 * must outlive every scope using its values.
+		 */
+		ConstantPool m_constants;
+
 		/**
 		 * The global scope for each assignment and definition.
 		 */
 		Scope m_globalScope;
+
+		/**
+		 * Nodes created to hold values loaded out of
+		 * packed arrays.
+		 *
+		 * These are borrowed the same way as elements of
+		 * boxed arrays, and are released once the statement
+		 * that loaded them is done executing.
+		 */
+		std::vector<AST::Node*> m_loaded;
+
+		/**
+		 * A call returned by a function, waiting to be
+		 * ran within the frame of the function returning
+		 * it, along with its evaluated arguments.
+		 *
+		 * The declaration is also what is returned to
+		 * unwind out of the body, and is only set until
+		 * the frame picks it up.
+		 */
+		AST::FunctionDeclaration* m_tailCall = nullptr;
+		Scope                     m_tailArguments;
+
+		/**
+		 * Set by a break or continue statement, which
+		 * stops each body it is nested within, up to
+		 * the loop running them.
+		 */
+		LoopControl               m_control = LoopControl::NONE;
+
+		/**
+		 * How many calls are currently nested, and how
+		 * many are allowed to be.
+		 *
+		 * Rather than nesting on the native stack the whole
+		 * way down, deep calls continue on stack segments of
+		 * their own, so that the depth is only limited by
+		 * memory and the maximum.
+		 */
+		size_t                    m_depth    = 0;
+		size_t                    m_maxDepth = DEFAULT_MAX_DEPTH;
+
+		/**
+		 * Where the stack currently being used began,
+		 * and how much of it calls may use.
+		 */
+		uintptr_t                 m_stackBase  = 0;
+		size_t                    m_stackUsage = FIRST_STACK_USE;
+
+		/**
+		 * Values returned by each pure function, when
+		 * memoizing.
+		 *
+		 * Declared after the constants, as it may hold
+		 * onto their values.
+		 */
+		bool                                                     m_memoize = false;
+		std::unordered_map<AST::FunctionDeclaration*, MemoTable> m_memos;
 		
 		/**
 		 * Take in an assignment node, and attempt to
@@ -141,6 +313,34 @@ namespace Shakara
 			Scope&               scope
 		);
 
+		/**
+		 * Try to run an assignment marked as a self update,
+		 * such as "a++" or "a = a * b", on an integer or
+		 * decimal by changing the value where it is held,
+		 * instead of making a new value and inserting it.
+		 *
+		 * Returns false if the value or right hand aren't
+		 * able to be updated in place, and nothing was
+		 * executed.
+		 */
+		bool _ExecuteSelfUpdate(
+			AST::AssignmentNode* assign,
+			Scope&               scope
+		);
+
+		/**
+		 * Try to run an assignment which appends to the
+		 * string already held by the identifier, such as
+		 * "a += b", by growing the string in place.
+		 *
+		 * Returns false if the assignment isn't an append
+		 * to a string, and nothing was executed.
+		 */
+		bool _ExecuteStringAppend(
+			AST::AssignmentNode* assign,
+			Scope&               scope
+		);
+
 		/**
 		 * Take in an if statement node, evaluate its condition
 		 * and subsequently, if true, run its body.
@@ -176,6 +376,70 @@ namespace Shakara
 			Scope&            scope
 		);
 
+		/**
+		 * Run a while statement once its hoisted values,
+		 * if it has any, have been set up for the run.
+		 */
+		void _ExecuteWhileLoop(
+			AST::WhileStatement* statement,
+			bool              function,
+			AST::Node**       returned,
+			Scope&            scope
+		);
+
+		/**
+		 * Clear any break or continue which stopped the
+		 * body of a loop, returning whether the loop
+		 * should stop as well.
+		 */
+		inline bool _StopLoop()
+		{
+			const bool stop = (m_control == LoopControl::BREAK);
+
+			m_control = LoopControl::NONE;
+
+			return stop;
+		}
+
+		/**
+		 * Run the body of a for statement once for each
+		 * integer of its range, or each element of its
+		 * array, within a scope of its own holding the
+		 * variable of the loop.
+		 */
+		void _ExecuteForStatement(
+			AST::ForStatement* statement,
+			bool               function,
+			AST::Node**        returned,
+			Scope&             scope
+		);
+
+		/**
+		 * Run a for statement over a range, counting the
+		 * variable of the loop up in place, rather than
+		 * creating a new integer for each iteration.
+		 */
+		void _ExecuteForRange(
+			AST::ForStatement* statement,
+			bool               function,
+			AST::Node**        returned,
+			Scope&             scope
+		);
+
+		/**
+		 * Run a for statement over the elements of an
+		 * array, which are read from a copy of the array
+		 * made before the first iteration, so nothing the
+		 * body does to the array changes what is gone
+		 * through, and no index has to be checked.
+		 */
+		void _ExecuteForEach(
+			AST::ForStatement* statement,
+			bool               function,
+			AST::Node**        returned,
+			Scope&             scope
+		);
+
 		/**
 		 * Take in a function declaration node and store
 		 * it as a variable in global scope.
@@ -191,6 +455,24 @@ namespace Shakara
 			Scope&               scope
 		);
 
+		/**
+		 * Evaluate all of the nodes within an array
+		 * definition into a new array.
+		 *
+		 * Returns nullptr if the definition is invalid.
+		 */
+		AST::ArrayNode* _EvaluateArray(
+			AST::ArrayNode*    arrayNode,
+			const std::string& identifier,
+			Scope&             scope
+		);
+
+		/**
+		 * Take in a struct declaration, and add it to
+		 * the global scope so it can be created.
+		 */
+		void _ExecuteStructDeclaration(AST::StructDeclaration* declaration);
+
 		/**
 		 * Take in a function call node, and attempt to
 		 * assign parameters and run the function.
@@ -203,6 +485,96 @@ namespace Shakara
 			Scope&             scope
 		);
 
+		/**
+		 * Run the body of a function within the scope
+		 * given, once the depth of calls is checked,
+		 * moving onto a new stack segment if needed.
+		 *
+		 * Returns the value returned by the function,
+		 * can be nullptr.
+		 */
+		AST::Node* _ExecuteBody(
+			AST::FunctionDeclaration* declaration,
+			Scope&                    functionScope
+		);
+
+		/**
+		 * Run the body of a function on the current stack,
+		 * along with any calls it returns, which reuse the
+		 * same scope rather than nesting.
+		 *
+		 * Returns the value returned by the last of
+		 * them, can be nullptr.
+		 */
+		AST::Node* _ExecuteFrame(
+			AST::FunctionDeclaration* declaration,
+			Scope&                    functionScope
+		);
+
+		/**
+		 * Build the key for the arguments a function was
+		 * called with, once they are within its scope.
+		 *
+		 * Returns false if any of them can't be used
+		 * as part of a key.
+		 */
+		bool _MemoKey(
+			AST::FunctionDeclaration* declaration,
+			Scope&                    functionScope,
+			std::string&              key
+		);
+
+		/**
+		 * Evaluate the arguments of a call and add
+		 * them to the scope of the function called.
+		 */
+		void _InsertArguments(
+			AST::FunctionDeclaration* declaration,
+			AST::FunctionCall*        call,
+			Scope&                    scope,
+			Scope&                    functionScope
+		);
+
+		/**
+		 * Create a new instance of a struct, with the
+		 * arguments of the call filling in its fields
+		 * in order, and the rest using their defaults.
+		 */
+		AST::Node* _ExecuteStructInstance(
+			AST::StructDeclaration* declaration,
+			AST::FunctionCall*      call,
+			Scope&                  scope
+		);
+
+		/**
+		 * Call a member function on a struct instance.
+		 *
+		 * The fields of the instance can be used by
+		 * name within the function's body.
+		 */
+		AST::Node* _ExecuteMethod(
+			AST::FunctionCall* call,
+			Scope&             scope
+		);
+
+		/**
+		 * Grab the struct instance that a member is
+		 * being accessed on.
+		 */
+		AST::StructNode* _GetMemberObject(
+			AST::MemberIdentifierNode* member,
+			Scope&                     scope
+		);
+
+		/**
+		 * Grab the value of a field of a struct, using
+		 * the slot cached within the member node.
+		 */
+		AST::Node* _GetMember(
+			AST::MemberIdentifierNode* member,
+			Scope&                     scope
+		);
+
 		/**
 		 * Take in a special print function call and
 		 * print out the arguments
@@ -312,6 +684,184 @@ namespace Shakara
 			Scope&             scope
 		);
 
+		/**
+		 * Take in a string and a range within it, and
+		 * return a string viewing that range, without
+		 * copying it.
+		 *
+		 * The range is a start and a length for substr
+		 * calls, and a start and an end for slice calls.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteSubstring(
+			AST::FunctionCall* substring,
+			Scope&             scope
+		);
+
+		/**
+		 * Take in a string and a separator, and return
+		 * an array of the parts of the string between
+		 * each separator.
+		 *
+		 * Each part is a view into the string, and an
+		 * empty separator splits every character.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteSplit(
+			AST::FunctionCall* split,
+			Scope&             scope
+		);
+
+		/**
+		 * Take in an array of strings and a separator,
+		 * and return a single string of every element
+		 * with the separator between them.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteJoin(
+			AST::FunctionCall* join,
+			Scope&             scope
+		);
+
+		/**
+		 * Take in an array of numbers and return either
+		 * the sum, minimum, or maximum of its elements.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteArrayReduction(
+			AST::FunctionCall* reduction,
+			Scope&             scope
+		);
+
+		/**
+		 * Take in an array of numbers and either another
+		 * array of the same size or a single number, and
+		 * return either the dot product, the array scaled
+		 * by the number, or the arrays added together.
+		 *
+		 * Integers are promoted to decimals if either
+		 * side holds decimals.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteArrayCombination(
+			AST::FunctionCall* combination,
+			Scope&             scope
+		);
+
+		/**
+		 * Take in an array and a value, and return the
+		 * amount of elements equal to the value.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteCount(
+			AST::FunctionCall* count,
+			Scope&             scope
+		);
+
+		/**
+		 * Take in a map and either return whether a key
+		 * is within it, or an array of every key within
+		 * it, in the order they were inserted.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteMapQuery(
+			AST::FunctionCall* query,
+			Scope&             scope
+		);
+
+		/**
+		 * Take in an array, and return a new array of
+		 * its elements sorted, either smallest or largest
+		 * first, and optionally keeping equal elements in
+		 * their order.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteSort(
+			AST::FunctionCall* sort,
+			Scope&             scope
+		);
+
+		/**
+		 * Take in an array and a value, and return the
+		 * index of the value within the array.
+		 *
+		 * Binary searches expect the array to be sorted
+		 * smallest first, and the lower bound is the
+		 * index the value would be inserted at to keep
+		 * the array sorted.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteSearch(
+			AST::FunctionCall* search,
+			Scope&             scope
+		);
+
+		/**
+		 * Create a new matrix from a number of rows and
+		 * columns, filled with zeros, or with the values
+		 * of an array, one row after another.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteMatrix(
+			AST::FunctionCall* matrix,
+			Scope&             scope
+		);
+
+		/**
+		 * Take in one matrix, or two to multiply, and
+		 * return either a new matrix, an array of the
+		 * sums of each row or column, or its size.
+		 *
+		 * The scope argument is used for functions
+		 * to grab variables defined within.
+		 */
+		AST::Node* _ExecuteMatrixOperation(
+			AST::FunctionCall* operation,
+			Scope&             scope
+		);
+
+		/**
+		 * Evaluate the row and column of an element of
+		 * a matrix into the offset of its value.
+		 *
+		 * Returns false if either is not a valid index.
+		 */
+		bool _GetMatrixOffset(
+			AST::MatrixNode*                 matrix,
+			AST::ArrayElementIdentifierNode* identifier,
+			Scope&                           scope,
+			size_t&                          offset
+		);
+
+		/**
+		 * Take in a map definition, and evaluate each of
+		 * its keys and values into a new map.
+		 */
+		AST::MapNode* _EvaluateMap(
+			AST::MapNode* definition,
+			Scope&        scope
+		);
+
 		/**
 		 * Checks the type of a node and prints it
 		 * accordingly.
@@ -327,6 +877,40 @@ namespace Shakara
 			Scope&                scope
 		);
 
+		/**
+		 * Execute a binary operation proven to only operate
+		 * on integers or decimals, without checking the type
+		 * of either side.
+		 *
+		 * Returns nullptr if a variable isn't set to a value
+		 * of its proven type, or an integer is divided by
+		 * zero, leaving the operation to be executed as any
+		 * other to report it.
+		 */
+		AST::Node* _ExecuteProvenOperation(
+			AST::BinaryOperation* operation,
+			Scope&                scope
+		);
+
+		/**
+		 * Evaluate an expression proven to be an integer,
+		 * or a decimal, straight into its value.
+		 *
+		 * Returns false under the same conditions as the
+		 * operation being executed.
+		 */
+		bool _EvaluateInteger(
+			AST::Node* expression,
+			Scope&     scope,
+			int32_t&   value
+		);
+
+		bool _EvaluateDecimal(
+			AST::Node* expression,
+			Scope&     scope,
+			float&     value
+		);
+
 		/**
 		 * Execute a logical operation and return a
 		 * singular BooleanNode from it
@@ -336,6 +920,56 @@ namespace Shakara
 			Scope&                scope
 		);
 
+		/**
+		 * Evaluate an argument of a built-in call into
+		 * the value it refers to.
+		 *
+		 * Temporary is set if the value was created for
+		 * the call, and must be released once done with,
+		 * otherwise the value is owned elsewhere, and must
+		 * be shared before being stored.
+		 */
+		AST::Node* _EvaluateArgument(
+			AST::Node* argument,
+			Scope&     scope,
+			bool&      temporary
+		);
+
+		/**
+		 * Evaluate an expression into a value owned by
+		 * the caller, for storing within a collection.
+		 */
+		AST::Node* _EvaluateOwned(
+			AST::Node* expression,
+			Scope&     scope
+		);
+
+		/**
+		 * Evaluate an expression hoisted out of the loop
+		 * it is within, only evaluating it the first time
+		 * for each run of the loop, and returning a copy
+		 * of the same value every time after.
+		 */
+		AST::Node* _ExecuteHoisted(
+			AST::Node* expression,
+			Scope&     scope
+		);
+
+		/**
+		 * Grab the node for an element of an array,
+		 * creating one if the array is packed.
+		 */
+		AST::Node* _LoadElement(
+			AST::ArrayNode* array,
+			size_t          index
+		);
+
+		/**
+		 * Release every node loaded out of a packed
+		 * array since the passed in amount were loaded.
+		 */
+		void _ReleaseLoaded(size_t amount);
+
 		/**
 		 * Grab a single node from an array element
 		 * identifier
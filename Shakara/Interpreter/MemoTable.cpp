@@ -0,0 +1,55 @@
+#include "../stdafx.hpp"
+#include "MemoTable.hpp"
+
+#include "../AST/ASTNode.hpp"
+
+using namespace Shakara;
+using namespace Shakara::AST;
+
+MemoTable::MemoTable(size_t capacity)
+	:
+	m_capacity(capacity)
+{
+}
+
+MemoTable::~MemoTable()
+{
+	for (auto& entry : m_entries)
+		ReleaseNode(entry.second);
+}
+
+Node* MemoTable::Find(const std::string& key)
+{
+	auto find = m_positions.find(key);
+
+	if (find == m_positions.end())
+		return nullptr;
+
+	// Move the entry to the front, without
+	// invalidating where it is kept
+	m_entries.splice(m_entries.begin(), m_entries, find->second);
+
+	return find->second->second;
+}
+
+void MemoTable::Insert(const std::string& key, Node* value)
+{
+	if (m_capacity == 0)
+	{
+		ReleaseNode(value);
+
+		return;
+	}
+
+	// Drop whichever value was used the longest ago
+	if (m_entries.size() >= m_capacity)
+	{
+		m_positions.erase(m_entries.back().first);
+		ReleaseNode(m_entries.back().second);
+
+		m_entries.pop_back();
+	}
+
+	m_entries.emplace_front(key, value);
+	m_positions[key] = m_entries.begin();
+}
\ No newline at end of file
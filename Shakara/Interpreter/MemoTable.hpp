@@ -0,0 +1,63 @@
+#pragma once
+
+namespace Shakara
+{
+	namespace AST
+	{
+		class Node;
+	}
+
+	/**
+	 * Values returned by a single pure function, keyed
+	 * by the arguments it was called with.
+	 *
+	 * Only holds up to a set amount of values, with
+	 * the value used least recently being dropped to
+	 * make room for a new one.
+	 */
+	class MemoTable
+	{
+	public:
+		static const size_t DEFAULT_CAPACITY = 4096;
+
+		MemoTable(size_t capacity=DEFAULT_CAPACITY);
+
+		~MemoTable();
+
+		MemoTable(const MemoTable&) = delete;
+
+		MemoTable& operator=(const MemoTable&) = delete;
+
+		/**
+		 * Grab the value stored for the key, marking
+		 * it as the most recently used.
+		 *
+		 * Returns nullptr if nothing is stored.
+		 */
+		AST::Node* Find(const std::string& key);
+
+		/**
+		 * Store a value for a key that isn't stored
+		 * yet, which is then owned by the table.
+		 */
+		void Insert(const std::string& key, AST::Node* value);
+
+		inline size_t Size() const
+		{
+			return m_entries.size();
+		}
+
+	private:
+		typedef std::list<std::pair<std::string, AST::Node*>> Entries;
+
+		/**
+		 * Each key and value, most recently used first,
+		 * along with where each key is within them.
+		 */
+		Entries                                               m_entries;
+		std::unordered_map<std::string, Entries::iterator>    m_positions;
+
+		size_t                                                m_capacity;
+
+	};
+}
\ No newline at end of file
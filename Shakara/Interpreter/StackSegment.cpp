@@ -0,0 +1,100 @@
+#include "../stdafx.hpp"
+#include "StackSegment.hpp"
+
+#include <exception>
+
+// The standard threads have no way of picking the
+// size of their stack, so each platform's own are used
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace Shakara;
+
+/**
+ * The work to be ran on a segment, along with
+ * anything it throws
+ */
+struct Segment
+{
+	const std::function<void()>* work = nullptr;
+	std::exception_ptr           error;
+};
+
+static void RunSegment(Segment* segment)
+{
+	try
+	{
+		(*segment->work)();
+	}
+	catch (...)
+	{
+		segment->error = std::current_exception();
+	}
+}
+
+#ifdef _WIN32
+static unsigned __stdcall SegmentEntry(void* argument)
+{
+	RunSegment(static_cast<Segment*>(argument));
+
+	return 0;
+}
+#else
+static void* SegmentEntry(void* argument)
+{
+	RunSegment(static_cast<Segment*>(argument));
+
+	return nullptr;
+}
+#endif
+
+bool Shakara::RunOnStackSegment(size_t size, const std::function<void()>& work)
+{
+	Segment segment;
+	segment.work = &work;
+
+#ifdef _WIN32
+	// Only reserved, so the stack is committed as it grows
+	HANDLE thread = reinterpret_cast<HANDLE>(_beginthreadex(
+		nullptr,
+		static_cast<unsigned>(size),
+		SegmentEntry,
+		&segment,
+		STACK_SIZE_PARAM_IS_A_RESERVATION,
+		nullptr
+	));
+
+	if (!thread)
+		return false;
+
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+#else
+	pthread_attr_t attributes;
+	pthread_t      thread;
+
+	if (pthread_attr_init(&attributes) != 0)
+		return false;
+
+	bool created = pthread_attr_setstacksize(&attributes, size) == 0 &&
+		pthread_create(&thread, &attributes, SegmentEntry, &segment) == 0;
+
+	pthread_attr_destroy(&attributes);
+
+	if (!created)
+		return false;
+
+	pthread_join(thread, nullptr);
+#endif
+
+	if (segment.error)
+		std::rethrow_exception(segment.error);
+
+	return true;
+}
\ No newline at end of file
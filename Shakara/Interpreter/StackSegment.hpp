@@ -0,0 +1,17 @@
+#pragma once
+
+namespace Shakara
+{
+	/**
+	 * Run work on a stack of its own, of the size given,
+	 * and wait for it to finish.
+	 *
+	 * Used to continue deep recursion on a new stack,
+	 * rather than overflowing the one in use. Anything
+	 * thrown by the work is thrown again by the caller.
+	 *
+	 * Returns false if the stack couldn't be created,
+	 * and the work wasn't ran.
+	 */
+	bool RunOnStackSegment(size_t size, const std::function<void()>& work);
+}
\ No newline at end of file
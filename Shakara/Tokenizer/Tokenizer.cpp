@@ -132,6 +132,75 @@ TokenizeError Tokenizer::Tokenize(
 			continue;
 		}
 
+		// Two periods in a row separate the start and
+		// end of a range, even right after a number
+		if (
+			current == '.'  &&
+			!parsingString  &&
+			stream.peek() == '.'
+		)
+		{
+			if (!value.empty())
+			{
+				Token token;
+				_SetTokenFromValue(&token, value);
+				token.line   = line;
+				token.column = column;
+
+				tokens.push_back(token);
+
+				value.clear();
+			}
+
+			stream.get(current);
+
+			Token range;
+			_SetTokenFromValue(&range, "..");
+			range.line   = line;
+			range.column = column;
+
+			tokens.push_back(range);
+
+			last = current;
+
+			column += 2;
+
+			continue;
+		}
+
+		// A period after an identifier accesses a member
+		// of a struct, while a period after a digit is
+		// the decimal point of a number
+		if (
+			current == '.'  &&
+			!parsingString  &&
+			!value.empty()  &&
+			!isdigit(value[0])
+		)
+		{
+			Token token;
+			_SetTokenFromValue(&token, value);
+			token.line   = line;
+			token.column = column;
+
+			tokens.push_back(token);
+
+			value.clear();
+
+			Token dot;
+			_SetTokenFromValue(&dot, std::string(1, current));
+			dot.line   = line;
+			dot.column = column;
+
+			tokens.push_back(dot);
+
+			last = current;
+
+			column++;
+
+			continue;
+		}
+
 		// Try and tokenize a single
 		// single character token like
 		// the beginning of a block
@@ -413,6 +482,12 @@ bool Tokenizer::_DetermineTokenTypeFromValue(TokenType* type, const std::string&
 		case ']':
 			*type = TokenType::RIGHT_BRACKET;
 			return true;
+		case ':':
+			*type = TokenType::COLON;
+			return true;
+		case '.':
+			*type = TokenType::DOT;
+			return true;
 		default: break;
 		}
 	}
@@ -438,6 +513,31 @@ bool Tokenizer::_DetermineTokenTypeFromValue(TokenType* type, const std::string&
 		*type = TokenType::WHILE_STATEMENT;
 		return true;
 	}
+	else if (value == "for")
+	{
+		*type = TokenType::FOR_STATEMENT;
+		return true;
+	}
+	else if (value == "break")
+	{
+		*type = TokenType::BREAK_STATEMENT;
+		return true;
+	}
+	else if (value == "continue")
+	{
+		*type = TokenType::CONTINUE_STATEMENT;
+		return true;
+	}
+	else if (value == "in")
+	{
+		*type = TokenType::IN;
+		return true;
+	}
+	else if (value == "..")
+	{
+		*type = TokenType::RANGE;
+		return true;
+	}
 	else if (value == "true")
 	{
 		*type = TokenType::BOOLEAN;
@@ -557,6 +657,7 @@ bool Tokenizer::_IsSingleCharacterToken(char character)
 	case ')':
 	case '[':
 	case ']':
+	case ':':
 		return true;
 	}
 
@@ -33,6 +33,9 @@ namespace Shakara
 		END_BLOCK               = 0x0C,
 		LEFT_BRACKET            = 0x0D,
 		RIGHT_BRACKET           = 0x0E,
+		COLON                   = 0x27,
+		DOT                     = 0x28,
+		RANGE                   = 0x2B,
 
 		/**
 		 * Type Tokens
@@ -77,7 +80,11 @@ namespace Shakara
 		 */
 		IF_STATEMENT            = 0x24,
 		ELSE_STATEMENT          = 0x25,
-		WHILE_STATEMENT         = 0x26
+		WHILE_STATEMENT         = 0x26,
+		FOR_STATEMENT           = 0x29,
+		IN                      = 0x2A,
+		BREAK_STATEMENT         = 0x2C,
+		CONTINUE_STATEMENT      = 0x2D
 	};
 
 	struct Token
@@ -9,5 +9,10 @@
 #include <vector>
 #include <functional>
 #include <map>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <cstring>
+#include <algorithm>
 
 #define SHAKARA_CMD_ARGS_NAME "shk__cmd_args"
\ No newline at end of file
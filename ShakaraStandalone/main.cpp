@@ -3,6 +3,10 @@
 #include <fstream>
 #include <functional>
 #include <map>
+#include <list>
+#include <unordered_map>
+#include <cstring>
+#include <cstdlib>
 
 #include "../Shakara/Tokenizer/TokenizerTypes.hpp"
 #include "../Shakara/Tokenizer/Tokenizer.hpp"
@@ -13,14 +17,35 @@
 
 int main(int argc, char* argv[])
 {
+	size_t maxDepth = Shakara::Interpreter::DEFAULT_MAX_DEPTH;
+	bool   memoize  = false;
+
+	// Options come before the file path, and are
+	// not passed on to the file being interpreted
+	int first = 1;
+
+	for (; first < argc && std::strncmp(argv[first], "--", 2) == 0; first++)
+	{
+		if (std::strncmp(argv[first], "--max-depth=", 12) == 0)
+			maxDepth = static_cast<size_t>(std::strtoull(argv[first] + 12, nullptr, 10));
+		else if (std::strcmp(argv[first], "--memoize") == 0)
+			memoize = true;
+		else
+		{
+			std::cerr << "Unknown option \"" << argv[first] << "\"!" << std::endl;
+
+			return 1;
+		}
+	}
+
 	// We have one argument, and thus, we can interpret
 	// a file
-	if (argc >= 2)
+	if (argc > first)
 	{
 		// Tokenize the file
 		std::vector<Shakara::Token> tokens;
 
-		std::ifstream file(argv[1]);
+		std::ifstream file(argv[first]);
 
 		Shakara::Tokenizer tokenizer;
 		tokenizer.Tokenize(file, tokens);
@@ -31,23 +56,29 @@ int main(int argc, char* argv[])
 		builder.Build(&root, tokens);
 
 		Shakara::Interpreter interpreter;
+		interpreter.MaxDepth(maxDepth);
+		interpreter.Memoize(memoize);
 		interpreter.ErrorHandler([]() {
 			exit(0);
 		});
 
 		// Pass each argument into the interpreter
-		// starting at 1
-		for (size_t index = 1; index < static_cast<size_t>(argc); index++)
+		// starting at the file path
+		for (size_t index = first; index < static_cast<size_t>(argc); index++)
 			interpreter.AppendCommandArgument(argv[index]);
 
 		interpreter.Execute(&root);
 	}
-	else if (argc == 1)
+	else
 	{
 		std::cout << "Shakara Interpreter" << std::endl;
 		std::cout << "-------------------" << std::endl;
 		std::cout << std::endl;
 		std::cout << "Input a file path as an argument to interpret Shakara code" << std::endl;
+		std::cout << std::endl;
+		std::cout << "Options, given before the file path:" << std::endl;
+		std::cout << "  --max-depth=<calls>  How deep calls may nest (default " << Shakara::Interpreter::DEFAULT_MAX_DEPTH << ")" << std::endl;
+		std::cout << "  --memoize            Remember the values returned by pure functions" << std::endl;
 	}
 
 	return 0;
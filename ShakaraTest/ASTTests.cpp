@@ -939,6 +939,90 @@ namespace ShakaraTest
 				);
 			}
 
+			TEST_METHOD(ASTBuildForStatement)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					for (index in 0..amt(values))
+						print(index)
+
+					for (value in values)
+					{
+						print(value)
+					}
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				// There should be a node for each loop
+				Assert::AreEqual(
+					static_cast<size_t>(2),
+					static_cast<size_t>(root.Children())
+				);
+
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::AST::NodeType::FOR_STATEMENT),
+					static_cast<uint8_t>(root[0]->Type())
+				);
+
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::AST::NodeType::FOR_STATEMENT),
+					static_cast<uint8_t>(root[1]->Type())
+				);
+
+				Shakara::AST::ForStatement* range = static_cast<Shakara::AST::ForStatement*>(root[0]);
+				Shakara::AST::ForStatement* each  = static_cast<Shakara::AST::ForStatement*>(root[1]);
+
+				// The first loop goes through a range, up
+				// to the amount of values
+				Assert::IsTrue(range->IsRange());
+
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::AST::NodeType::INTEGER),
+					static_cast<uint8_t>(range->Start()->Type())
+				);
+
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::AST::NodeType::CALL),
+					static_cast<uint8_t>(range->End()->Type())
+				);
+
+				Assert::AreEqual(
+					static_cast<size_t>(1),
+					static_cast<size_t>(static_cast<Shakara::AST::RootNode*>(range->Body())->Children())
+				);
+
+				// While the second goes through each value
+				Assert::IsFalse(each->IsRange());
+
+				Assert::AreEqual(
+					std::string("value"),
+					static_cast<Shakara::AST::IdentifierNode*>(each->Identifier())->Value()
+				);
+
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::AST::NodeType::IDENTIFIER),
+					static_cast<uint8_t>(each->Iterable()->Type())
+				);
+
+				Assert::AreEqual(
+					static_cast<size_t>(1),
+					static_cast<size_t>(static_cast<Shakara::AST::RootNode*>(each->Body())->Children())
+				);
+			}
+
 			TEST_METHOD(ASTBuildArrayDefines)
 			{
 				// Create a test statement and insert
@@ -0,0 +1,285 @@
+#include "stdafx.hpp"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ShakaraTest
+{
+	namespace AST
+	{
+		TEST_CLASS(CheckerTests)
+		{
+		public:
+			TEST_METHOD(CheckMisplacedStatements)
+			{
+				// Create a test statement with a function
+				// declared within another, and a return
+				// outside of any function
+				std::string code = R"(
+					outer = ()
+					{
+						inner = ()
+						{
+							return 1
+						}
+
+						return 2
+					}
+
+					print("Unreachable")
+
+					return 3
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				// Both errors should be reported, but the
+				// handler should only be called once
+				size_t handled = 0;
+
+				Shakara::AST::ASTChecker checker;
+				checker.ErrorHandler([&handled]() {
+					handled++;
+				});
+
+				Assert::IsFalse(checker.Check(&root));
+				Assert::AreEqual(static_cast<size_t>(1), handled);
+
+				// The interpreter should refuse to run
+				// anything at all from the AST
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				Assert::AreEqual(
+					"",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(CheckFunctionArguments)
+			{
+				// Create a test statement with one matching
+				// and one mismatched call to a function
+				std::string code = R"(
+					add = (first, second)
+					{
+						return first + second
+					}
+
+					print(add(1, 2))
+					add(1)
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				Shakara::AST::ASTChecker checker;
+
+				Assert::IsFalse(checker.Check(&root));
+
+				// The call within the print should be marked
+				// as checked, while the mismatched one should not
+				Shakara::AST::FunctionCall* print = static_cast<Shakara::AST::FunctionCall*>(root[1]);
+				Shakara::AST::FunctionCall* call  = static_cast<Shakara::AST::FunctionCall*>(print->Arguments()[0]);
+
+				Assert::IsTrue(call->ArgumentsChecked());
+				Assert::IsFalse(static_cast<Shakara::AST::FunctionCall*>(root[2])->ArgumentsChecked());
+
+				// Make sure the mismatched call is positioned
+				// at the identifier it was made with
+				Assert::AreEqual(static_cast<uint32_t>(8), root[2]->Line());
+			}
+
+			TEST_METHOD(CheckPureFunctions)
+			{
+				// Create a test statement with functions that
+				// only compute, and ones which print, change a
+				// global, change an array, or call one of them
+				std::string code = R"(
+					total = 0
+
+					fib = (n)
+					{
+						if (n < 2)
+						{
+							return n
+						}
+
+						return fib(n - 1) + fib(n - 2)
+					}
+
+					twice = (n)
+					{
+						doubled = fib(n) * 2
+
+						return doubled
+					}
+
+					noisy = (n)
+					{
+						print(n)
+
+						return n
+					}
+
+					bump = (n)
+					{
+						total = total + n
+
+						return total
+					}
+
+					fill = (values)
+					{
+						values[0] = 1
+
+						return values
+					}
+
+					loud = (n)
+					{
+						return noisy(n) + fib(n)
+					}
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				Shakara::AST::ASTChecker checker;
+
+				Assert::IsTrue(checker.Check(&root));
+
+				// Only the functions which compute from their
+				// arguments alone should be marked as pure
+				const bool expected[] = { true, true, false, false, false, false };
+
+				for (size_t index = 0; index < 6; index++)
+					Assert::AreEqual(
+						expected[index],
+						static_cast<Shakara::AST::FunctionDeclaration*>(root[index + 1])->Pure()
+					);
+			}
+
+			TEST_METHOD(CheckForVariables)
+			{
+				// Create a test statement which reads the
+				// variable of each loop, but assigns to it
+				// within the second
+				std::string code = R"(
+					values = [] { 1, 2, 3 }
+
+					for (index in 0..amt(values))
+						print(values[index])
+
+					for (value in values)
+					{
+						value += 1
+					}
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				Shakara::AST::ASTChecker checker;
+
+				Assert::IsFalse(checker.Check(&root));
+			}
+
+			TEST_METHOD(CheckLoopControl)
+			{
+				// Create a test statement which breaks out of
+				// a loop correctly, but also breaks outside of
+				// any loop, and continues within a function
+				// declared within a loop
+				std::string code = R"(
+					while (true)
+					{
+						if (true)
+							break
+
+						skip = ()
+						{
+							continue
+						}
+					}
+
+					break
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::AST::NodeType::BREAK),
+					static_cast<uint8_t>(root[1]->Type())
+				);
+
+				// Both misplaced statements should be reported,
+				// but the handler should only be called once
+				size_t handled = 0;
+
+				Shakara::AST::ASTChecker checker;
+				checker.ErrorHandler([&handled]() {
+					handled++;
+				});
+
+				Assert::IsFalse(checker.Check(&root));
+				Assert::AreEqual(static_cast<size_t>(1), handled);
+			}
+
+		};
+	}
+}
\ No newline at end of file
@@ -739,6 +739,1438 @@ namespace ShakaraTest
 				);
 			}
 
+			TEST_METHOD(InterpretSharedConstants)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					a = 5
+					a = type(a)
+					b = 1 < 2
+					b = 3
+					c = [3] { 1, 2, 3 }
+					c[0] = 4
+					d = c[0]
+					e = [2] { true, false }
+					c = 0
+					print(a, b, amt(e), d, integer(true), string(false))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Shared values should survive being
+				// replaced, so should be "integer3241false"
+				Assert::AreEqual(
+					"integer3241false",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretStringAppend)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					count  = 0
+					buffer = ""
+
+					while (count < 5)
+					{
+						buffer += "ab"
+						count++
+					}
+
+					copy   = buffer + ""
+					buffer = buffer + "!"
+
+					print(buffer, copy)
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Appending shouldn't change the copy, so
+				// should be "ababababab!ababababab"
+				Assert::AreEqual(
+					"ababababab!ababababab",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretSubstrings)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					record = "0042Alice  NY"
+					name   = substr(record, 4, 7)
+					state  = slice(record, 11, 13)
+					name  += "!"
+
+					print(integer(substr(record, 0, 4)), name, state, amt(state), record)
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Appending to a substring shouldn't change
+				// the string it was grabbed from
+				Assert::AreEqual(
+					"42Alice  !NY20042Alice  NY",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretSplitJoin)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					fields  = split("id,,name,age", ",")
+					letters = split("abc", "")
+					words   = [] { }
+
+					print(amt(fields), fields[1], fields[3], amt(letters), letters[2])
+					print(join(fields, "::"), join(split("a--b--", "--"), "+"), join(words, ","))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Empty parts should be kept, so should be
+				// "4age3cid::::name::agea+b+"
+				Assert::AreEqual(
+					"4age3cid::::name::agea+b+",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretPackedArrays)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					numbers = [4] { 1, 2, 3 }
+					numbers[1] = 5000
+					push(numbers, 4)
+					mixed = [3] { 1.5, 2.5 }
+					mixed[0] = "a"
+					flags = [2] { true, false }
+					total = numbers[0] + numbers[1] + numbers[2] + numbers[3]
+
+					print(total, mixed[0], mixed[1], flags[1], amt(numbers), type(mixed[1]))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Values should be the same whether packed or not, so
+				// should be "5008a2.5false4decimal"
+				Assert::AreEqual(
+					"5008a2.5false4decimal",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretArrayMath)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					numbers  = [9] { 5, 3, 12, 7, 1, 9, 8, 4, 7 }
+					decimals = [5] { 1.5, 2.5, 1.0, 4.0, 0.5 }
+					mixed    = [3] { 1, 2.5, 3 }
+					doubled  = scale(numbers, 2)
+					summed   = add_each(numbers, doubled)
+
+					print(sum(numbers), " ", min(numbers), " ", max(numbers), " ", dot(numbers, numbers), " ", count(numbers, 7))
+					print(" ", sum(decimals), " ", min(decimals), " ", sum(mixed), " ", summed[2], " ", sum(scale(decimals, 2)))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Integers should be promoted to decimals when mixed, so
+				// should be "56 1 12 438 2 9.5 0.5 6.5 36 19"
+				Assert::AreEqual(
+					"56 1 12 438 2 9.5 0.5 6.5 36 19",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretQueueArrays)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					queue = [] { }
+					count = 0
+
+					while (count < 6)
+					{
+						push(queue, count)
+						count++
+					}
+
+					pop(queue, 0)
+					pop(queue, 0)
+					pop(queue, 0)
+					push(queue, 6)
+					pop(queue, 1)
+					pop(queue, 2)
+					push(queue, "x")
+					pop(queue, 0)
+
+					print(queue[0], queue[1], amt(queue))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Popping from the front moves the head of the array
+				// while middle and end pops still remove the right
+				// elements, so should be "5x2"
+				Assert::AreEqual(
+					"5x2",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretFixedArrays)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					fixed = [4] { 1, 2 }
+					push(fixed, 3)
+					push(fixed, 4)
+					dynamic = [] { "a", "b" }
+					push(dynamic, "c")
+					empty = [3]
+					push(empty, true)
+
+					print(amt(fixed), fixed[3], amt(dynamic), dynamic[2], amt(empty), empty[0])
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Fixed arrays can be filled up to their capacity, and
+				// dynamic arrays can be declared with elements, so
+				// should be "443c1true"
+				Assert::AreEqual(
+					"443c1true",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretArrayValues)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					grow = (list)
+					{
+						push(list, 4)
+						list[0] = 9
+
+						return list
+					}
+
+					numbers = [] { }
+					push(numbers, 1)
+					push(numbers, 2)
+					push(numbers, 3)
+					grown = grow(numbers)
+					copy = numbers
+					pop(copy, 0)
+					words = [2] { "a", "b" }
+					other = words
+					other[1] = "c"
+
+					print(amt(numbers), numbers[0], amt(grown), grown[0], amt(copy), copy[0], words[1], other[1])
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Arrays are copied when passed, returned, or assigned,
+				// so changing a copy leaves the original alone and
+				// should be "314922bc"
+				Assert::AreEqual(
+					"314922bc",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretMaps)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					ages = { "ann": 31, "bob": 27, 3: "three" }
+					ages["cal"] = 40
+					ages["bob"] += 1
+					name = "ann"
+					pop(ages, 3)
+					seen = {}
+					words = split("a b a c b a", " ")
+					index = 0
+
+					while (index < amt(words))
+					{
+						seen[words[index]] = true
+						index++
+					}
+
+					print(ages[name], ages["bob"], amt(ages), has(ages, 3), has(ages, "cal"), join(keys(seen), ","), type(seen))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Test defining maps, then setting, reading,
+				// and removing their keys
+				Assert::AreEqual(
+					"31283falsetruea,b,cmap",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretStructs)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					point
+					{
+						x = 0
+						y = 0
+						tags = [] { }
+
+						move = (dx, dy)
+						{
+							x += dx
+							y += dy
+						}
+
+						total = ()
+						{
+							return x + y
+						}
+					}
+
+					line
+					{
+						name = "line"
+						start = point()
+					}
+
+					p = point(1, 2)
+					p.move(3, 4)
+					q = p
+					q.x = 9
+					push(p.tags, 5)
+					l = line("l")
+					l.start.move(1, 1)
+
+					print(p.x, p.y, q.x, p.total(), amt(p.tags), amt(q.tags), l.name, l.start.x, type(p))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Fields are copied along with the instance,
+				// so changing q must leave p as it was
+				Assert::AreEqual(
+					"4691010l1struct",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretSort)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					scores = [] { 5, 12, 9, 0, 9, 3 }
+					rates = [] { 2.5, 1.5, 0.5 }
+					names = [] { "cal", "ann", "bob", "an" }
+					mixed = [] { 2, 1.0, 1, 0.5 }
+					flags = [] { true, false, true }
+					up = sort(scores)
+					down = sort_desc(scores)
+					low = sort(rates)
+					stable = sort(mixed, true)
+					truth = sort_desc(flags)
+
+					print(up[0], up[5], down[0], down[5], low[0], join(sort(names), ","), join(sort_desc(names), ","))
+					print(type(stable[1]), type(stable[2]), truth[0], truth[2], scores[0], amt(up))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Sorting with the stable flag keeps 1.0 before 1,
+				// as they were in that order within the array
+				Assert::AreEqual(
+					"0121200.5an,ann,bob,calcal,bob,ann,andecimalintegertruefalse56",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretSearch)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					ids = [] { 2, 3, 5, 7, 11, 13, 17, 19, 23 }
+					rates = [] { 0.5, 1.5, 2.5 }
+					names = sort([] { "cal", "ann", "bob" })
+
+					print(index_of(ids, 13), index_of(ids, 4), index_of(names, "bob"), " ")
+					print(bsearch(ids, 17), bsearch(ids, 4), lower_bound(ids, 4), lower_bound(ids, 50), " ")
+					print(bsearch(rates, 1.5), lower_bound(rates, 2), bsearch(names, "cal"), lower_bound(names, "b"))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Binary searches give -1 for a missing value,
+				// while the lower bound is where it would go
+				Assert::AreEqual(
+					"5-11 6-129 1221",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretMatrices)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					weights = matrix(2, 3, [] { 1, 2, 3, 4, 5, 6 })
+					features = matrix(3, 1, [] { 1.0, 0.5, 2 })
+					scores = matmul(weights, features)
+					flipped = transpose(weights)
+					copy = weights
+					copy[0][1] = 10
+					copy[1][2] += 1
+					row = 1
+					rowSums = row_sums(weights)
+					colSums = col_sums(weights)
+
+					print(scores[0][0], " ", scores[row][0], " ", rows(flipped), cols(flipped), " ", flipped[2][0], " ")
+					print(weights[0][1], " ", copy[0][1], " ", copy[1][2], " ", rowSums[1], " ", colSums[2], " ", type(weights))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Copies of a matrix share its values until one
+				// is changed, so weights must be left as it was
+				Assert::AreEqual(
+					"8 18.5 32 3 2 10 7 15 9 matrix",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretTailCalls)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					total = (n, acc) {
+						if (n == 0) {
+							return acc
+						}
+						return total(n - 1, acc + n)
+					}
+
+					even = (n) {
+						if (n == 0) {
+							return true
+						}
+						return odd(n - 1)
+					}
+
+					odd = (n) {
+						if (n == 0) {
+							return false
+						}
+						return even(n - 1)
+					}
+
+					climb = (n, limit) {
+						while (n < limit) {
+							return climb(n + 1, limit)
+						}
+						return n
+					}
+
+					stretch = (v, times) {
+						return v * times
+					}
+
+					box
+					{
+						size = 3
+
+						grow = (times)
+						{
+							return stretch(size, times)
+						}
+					}
+
+					b = box(4)
+					start = 10
+
+					print(total(60000, 0), even(100001), climb(start, 50000), b.grow(5))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Returned calls run in the frame returning them,
+				// so deep recursion through returns never nests
+				Assert::AreEqual(
+					"1800030000false5000020",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretDeepRecursion)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					down = (n) {
+						if (n == 0) {
+							return 0
+						}
+						return down(n - 1) + 1
+					}
+
+					print(down(100000))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Deep calls continue on stack segments of their own,
+				// rather than overflowing the stack
+				Assert::AreEqual(
+					"100000",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretMemoizedFunctions)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					fib = (n) {
+						if (n < 2) {
+							return n
+						}
+						return fib(n - 1) + fib(n - 2)
+					}
+
+					total = 0
+
+					noisy = (n) {
+						print("x")
+						return n
+					}
+
+					bump = (n) {
+						total = total + n
+						return total
+					}
+
+					greet = (name, loud) {
+						if (loud) {
+							return name + "!"
+						}
+						return name
+					}
+
+					print(fib(40), " ", noisy(1), noisy(1), " ", bump(1), bump(1), " ", greet("hi", true), greet("hi", false), greet("hi", true))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Memoize(true);
+				interpreter.Execute(&root);
+
+				// Pure functions only run once for each set of
+				// arguments, while impure ones run every time
+				Assert::AreEqual(
+					"102334155 x1x1 12 hi!hihi!",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretInlinedCalls)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					odd = (n) {
+						return n % 2 != 0
+					}
+
+					area = (w, h) {
+						return w * h
+					}
+
+					first = (values) {
+						return values[0]
+					}
+
+					size = (values) {
+						return amt(values)
+					}
+
+					swap = (p, q) {
+						return q - p
+					}
+
+					pick = () {
+						return 7
+					}
+
+					both = (p, q) {
+						return p + q
+					}
+
+					use = (x) {
+						return odd(x)
+					}
+
+					xs = [] { 4, 5, 6 }
+					a = 2
+					b = 10
+					i = 0
+					count = 0
+					while (i < 10) {
+						if (odd(i)) {
+							count++
+						}
+						i++
+					}
+					print(count, " ", area(a + 1, b), " ", first(xs), " ", size(xs), " ", swap(b, a), " ", pick(), " ", both(area(a, a), 1), " ", use(3), " ")
+
+					pick = () {
+						return 8
+					}
+
+					print(pick(), " ", odd(a * 3 + 1))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Small functions are inlined where they are called,
+				// and called again once they are declared anew
+				Assert::AreEqual(
+					"5 30 4 3 -8 7 5 true 8 false",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretHoistedLoops)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					scaled = (n, k) {
+						total = 0
+						j = 0
+						while (j < n) {
+							total = total + k * 2
+							j = j + 1
+						}
+						return total
+					}
+
+					grow = () {
+						push(xs, 1)
+					}
+
+					xs = [] { 1, 2, 3 }
+					limit = 4
+					i = 0
+					out = 0
+					while (i < amt(xs) * limit) {
+						out = out + limit * 10 + scaled(limit, 3)
+						if (i == 5) {
+							limit = 2
+						}
+						i = i + 1
+					}
+					print(out, " ")
+
+					k = 0
+					while (k < amt(xs)) {
+						if (k < 2) {
+							grow()
+						}
+						k = k + 1
+					}
+					print(k, " ")
+
+					row = 0
+					cells = 0
+					while (row < 3) {
+						col = 0
+						while (col < limit + 1) {
+							cells = cells + row * limit
+							col = col + 1
+						}
+						row = row + 1
+					}
+					print(cells, " ")
+
+					n = 0
+					words = ""
+					while (n < 3) {
+						words = words + string(limit) + "!"
+						n = n + 1
+					}
+					print(words)
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Expressions which never change while a loop runs
+				// are only evaluated once for each run of it, while
+				// anything the loop writes to, or that a call could
+				// change, is evaluated each iteration
+				Assert::AreEqual(
+					"816 5 18 2!2!2!",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretCountedLoops)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					values = [] { 4, 8, 15, 16, 23, 42 }
+					total = 0
+					i = 0
+					while (i < amt(values)) {
+						total = total + values[i]
+						values[i] = values[i] * 2
+						i = i + 1
+					}
+					print(total, " ", values[5], " ")
+
+					words = [] { "a", "b", "c" }
+					joined = ""
+					j = 0
+					while (amt(words) > j) {
+						if (j > 0) {
+							joined = joined + "-"
+						}
+						joined = joined + words[j]
+						j = j + 1
+					}
+					print(joined, " ")
+
+					grid = [] { 1, 2, 3 }
+					k = 0
+					pairs = 0
+					while (k < amt(grid)) {
+						m = 0
+						while (m < amt(grid)) {
+							pairs = pairs + grid[k] * grid[m]
+							m = m + 1
+						}
+						k = k + 1
+					}
+					print(pairs, " ")
+
+					n = 0
+					steps = 0
+					while (n < amt(grid)) {
+						n = n + 2
+						if (n < amt(grid)) {
+							steps = steps + grid[n]
+						}
+					}
+					print(steps)
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Elements indexed by a counted loop's index before
+				// it is counted up skip checking the bounds, while
+				// any other access is still checked
+				Assert::AreEqual(
+					"108 84 a-b-c 36 3",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretInferredTypes)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					average = (list) {
+						total = 0.0
+						index = 0
+						while (index < amt(list)) {
+							total = total + list[index]
+							index = index + 1
+						}
+						return total / amt(list)
+					}
+
+					i = 0
+					evens = 0
+					scaled = 0.5
+					while (i < 20) {
+						if (i % 2 == 0) {
+							evens = evens + 1
+						}
+						scaled = scaled * 2 - i / 4
+						i = i + 1
+					}
+					print(evens, " ", scaled, " ")
+
+					mixed = 3
+					mixed = "three"
+					print(mixed + "!", " ")
+
+					near = 1.5
+					print(near < 2.0, " ", near * 2 >= 3.0, " ", i - evens * 2 == 0, " ")
+					print(average([] { 1, 2, 3, 4 }), " ")
+					print(integer(7 / 2) + amt("four"))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Variables only ever given integers or decimals are
+				// evaluated directly, while one also given a string
+				// keeps going through the regular path
+				Assert::AreEqual(
+					"10 0 three! true true true 2.5 7",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretSelfUpdates)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					counter
+					{
+						hits = 0
+
+						hit = (amount)
+						{
+							hits += amount
+							hits++
+						}
+					}
+
+					bump = (n)
+					{
+						n += 1000
+						return n
+					}
+
+					i = 0
+					big = 5000
+					scale = 2
+					while (i < 10) {
+						big += i
+						scale = scale * 1.5
+						i++
+					}
+					copy = big
+					big--
+					print(i, " ", big, " ", copy, " ", scale, " ")
+
+					x = 2000
+					y = bump(x)
+					print(x, " ", y, " ")
+
+					c = counter()
+					c.hit(4)
+					c.hit(5)
+					print(c.hits, " ")
+
+					word = "a"
+					word += "b"
+					half = 7
+					half /= 2
+					print(word, " ", half)
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Increments, compound assignments, and assignments of
+				// an operation on the variable itself update the value
+				// in place, without changing copies of it
+				Assert::AreEqual(
+					"10 5044 5045 115.33 2000 3000 11 ab 3",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretForLoops)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					values = [] { 3, 4, 5 }
+					total  = 0
+
+					for (index in 0..amt(values))
+						total += values[index]
+
+					print(total, " ")
+
+					for (value in values)
+						print(value, " ")
+
+					decimals = [] { 1.5, 2.5 }
+
+					for (value in decimals)
+					{
+						print(value, " ")
+					}
+
+					words = [] { "ab", "cd" }
+
+					for (word in words)
+					{
+						print(word, " ")
+
+						words[0] = "zz"
+					}
+
+					print(words[0], " ")
+
+					flags = [] { true, false }
+
+					for (flag in flags)
+						print(flag, " ")
+
+					find = (array, wanted)
+					{
+						for (index in 0..amt(array))
+						{
+							if (array[index] == wanted)
+								return index
+						}
+
+						return 99
+					}
+
+					print(find(values, 5), " ", find(values, 7), " ")
+
+					for (outer in 0..3)
+						for (inner in outer..3)
+							print(outer, inner, " ")
+
+					last = 2
+
+					for (index in last..last)
+						print("never")
+
+					empty = []
+
+					for (value in empty)
+						print("never")
+
+					print("end")
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Go through ranges, including an empty one, and
+				// arrays of each storage, returning from within
+				// one inside of a function
+				Assert::AreEqual(
+					"12 3 4 5 1.5 2.5 ab cd zz true false 2 99 00 01 02 11 12 22 end",
+					output.str().c_str()
+				);
+			}
+
+			TEST_METHOD(InterpretBreakContinue)
+			{
+				// Create a test statement and insert
+				// it into a stringstream
+				std::string code = R"(
+					values = [] { 4, 8, 15, 16, 23, 42 }
+
+					index = 0
+
+					while (index < amt(values))
+					{
+						if (values[index] == 16)
+							break
+
+						index += 1
+					}
+
+					print(index, " ")
+
+					for (value in values)
+					{
+						if (value % 2 == 1)
+							continue
+
+						print(value, " ")
+					}
+
+					find = (array, wanted)
+					{
+						found = 99
+
+						for (position in 0..amt(array))
+						{
+							if (array[position] == wanted)
+							{
+								found = position
+
+								break
+							}
+						}
+
+						return found
+					}
+
+					print(find(values, 23), " ", find(values, 5), " ")
+
+					for (outer in 0..3)
+					{
+						for (inner in 0..3)
+						{
+							if (inner == 1)
+								continue
+
+							if (inner > outer)
+								break
+
+							print(outer, inner, " ")
+						}
+					}
+
+					count = 0
+					total = 0
+
+					while (count < 10)
+					{
+						count += 1
+
+						if (count % 3 == 0)
+							continue
+
+						total += count
+					}
+
+					print(total, " ")
+
+					first = (array)
+					{
+						for (value in array)
+						{
+							if (value > 10)
+								return value
+						}
+
+						return 0
+					}
+
+					print(first(values))
+				)";
+
+				std::stringstream stream(code, std::ios::in);
+
+				// Tokenize the stringstream
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Run the ASTBuilder to grab an AST
+				Shakara::AST::RootNode   root;
+				Shakara::AST::ASTBuilder builder;
+				builder.Build(&root, tokens);
+
+				std::stringstream output;
+
+				Shakara::Interpreter interpreter(output);
+				interpreter.Execute(&root);
+
+				// Leave while and for loops early, both directly
+				// and from within if statements, nested loops,
+				// and functions
+				Assert::AreEqual(
+					"3 4 8 16 42 4 99 00 10 20 22 37 15",
+					output.str().c_str()
+				);
+			}
+
 		};
 	}
 }
\ No newline at end of file
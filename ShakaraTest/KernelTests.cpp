@@ -0,0 +1,162 @@
+#include "stdafx.hpp"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ShakaraTest
+{
+	namespace Interpreter
+	{
+		TEST_CLASS(KernelTests)
+		{
+		public:
+
+			TEST_METHOD(KernelsMatchScalarLoops)
+			{
+				// Use an amount of values that isn't a multiple
+				// of the vector width, so both the vectorized
+				// and scalar parts of each kernel are used
+				std::vector<int32_t> integers = { 7, -3, 12, 0, -8, 5, 2147483647, 1, -2147483647 - 1, 4, 9 };
+				std::vector<float>   decimals = { 1.5f, -2.0f, 0.25f, 8.0f, -0.5f, 3.0f, 2.0f };
+
+				int32_t sum = 0;
+				int32_t dot = 0;
+
+				for (size_t index = 0; index < integers.size(); index++)
+				{
+					sum = static_cast<int32_t>(static_cast<uint32_t>(sum) + static_cast<uint32_t>(integers[index]));
+					dot = static_cast<int32_t>(
+						static_cast<uint32_t>(dot) +
+						static_cast<uint32_t>(integers[index]) * static_cast<uint32_t>(integers[index])
+					);
+				}
+
+				Assert::AreEqual(sum, Shakara::Kernels::SumIntegers(integers.data(), integers.size()));
+				Assert::AreEqual(dot, Shakara::Kernels::DotIntegers(integers.data(), integers.data(), integers.size()));
+				Assert::AreEqual(-2147483647 - 1, Shakara::Kernels::MinIntegers(integers.data(), integers.size()));
+				Assert::AreEqual(2147483647, Shakara::Kernels::MaxIntegers(integers.data(), integers.size()));
+
+				Assert::AreEqual(12.25f, Shakara::Kernels::SumDecimals(decimals.data(), decimals.size()));
+				Assert::AreEqual(-2.0f, Shakara::Kernels::MinDecimals(decimals.data(), decimals.size()));
+				Assert::AreEqual(8.0f, Shakara::Kernels::MaxDecimals(decimals.data(), decimals.size()));
+
+				std::vector<int32_t> scaled(integers.size());
+				Shakara::Kernels::ScaleIntegers(integers.data(), -3, scaled.data(), integers.size());
+
+				Assert::AreEqual(-21, scaled[0]);
+				Assert::AreEqual(-27, scaled[10]);
+
+				std::vector<int32_t> added(integers.size());
+				Shakara::Kernels::AddIntegers(integers.data(), scaled.data(), added.data(), integers.size());
+
+				Assert::AreEqual(-14, added[0]);
+				Assert::AreEqual(-18, added[10]);
+
+				integers.push_back(7);
+
+				Assert::AreEqual(static_cast<size_t>(2), Shakara::Kernels::CountIntegers(integers.data(), integers.size(), 7));
+				Assert::AreEqual(static_cast<size_t>(1), Shakara::Kernels::CountDecimals(decimals.data(), decimals.size(), 2.0f));
+
+				Assert::AreEqual(static_cast<size_t>(6), Shakara::Kernels::IndexOfIntegers(integers.data(), integers.size(), 2147483647));
+				Assert::AreEqual(static_cast<size_t>(0), Shakara::Kernels::IndexOfIntegers(integers.data(), integers.size(), 7));
+				Assert::AreEqual(integers.size(), Shakara::Kernels::IndexOfIntegers(integers.data(), integers.size(), 6));
+				Assert::AreEqual(static_cast<size_t>(6), Shakara::Kernels::IndexOfDecimals(decimals.data(), decimals.size(), 2.0f));
+			}
+
+			TEST_METHOD(KernelsSortLikeStandardSort)
+			{
+				// Use enough values that the runs sorted on
+				// separate threads are merged together
+				std::vector<int32_t> integers(300007);
+				std::vector<float>   decimals(300007);
+
+				uint32_t state = 12345;
+
+				for (size_t index = 0; index < integers.size(); index++)
+				{
+					state = state * 1103515245u + 12345u;
+
+					integers[index] = static_cast<int32_t>(state);
+					decimals[index] = static_cast<float>(state % 1000) / 8.0f;
+				}
+
+				std::vector<int32_t> expected = integers;
+				std::sort(expected.begin(), expected.end());
+
+				Shakara::Kernels::SortIntegers(integers.data(), integers.size(), false);
+
+				Assert::IsTrue(expected == integers);
+
+				Shakara::Kernels::SortIntegers(integers.data(), integers.size(), true);
+
+				Assert::IsTrue(std::is_sorted(integers.begin(), integers.end(), std::greater<int32_t>()));
+
+				decimals[7] = std::nanf("");
+
+				Shakara::Kernels::SortDecimals(decimals.data(), decimals.size(), false);
+
+				Assert::IsTrue(std::is_sorted(decimals.begin(), decimals.end() - 1));
+				Assert::IsTrue(std::isnan(decimals.back()));
+			}
+
+
+			TEST_METHOD(MatrixKernelsMatchScalarLoops)
+			{
+				// Use sizes that aren't a multiple of either the
+				// block size or the vector width
+				const size_t rows    = 70;
+				const size_t inner   = 67;
+				const size_t columns = 69;
+
+				std::vector<float> left(rows * inner);
+				std::vector<float> right(inner * columns);
+
+				for (size_t index = 0; index < left.size(); index++)
+					left[index] = static_cast<float>(index % 7) - 3.0f;
+
+				for (size_t index = 0; index < right.size(); index++)
+					right[index] = static_cast<float>(index % 5) * 0.5f;
+
+				std::vector<float> product(rows * columns);
+				Shakara::Kernels::MultiplyMatrices(left.data(), right.data(), product.data(), rows, inner, columns);
+
+				for (size_t row = 0; row < rows; row++)
+				{
+					for (size_t column = 0; column < columns; column++)
+					{
+						float expected = 0.0f;
+
+						for (size_t step = 0; step < inner; step++)
+							expected += left[row * inner + step] * right[step * columns + column];
+
+						Assert::AreEqual(expected, product[row * columns + column]);
+					}
+				}
+
+				std::vector<float> transposed(rows * inner);
+				Shakara::Kernels::TransposeMatrix(left.data(), transposed.data(), rows, inner);
+
+				for (size_t row = 0; row < rows; row++)
+					for (size_t column = 0; column < inner; column++)
+						Assert::AreEqual(left[row * inner + column], transposed[column * rows + row]);
+
+				std::vector<float> rowSums(rows);
+				std::vector<float> columnSums(inner);
+				Shakara::Kernels::SumRows(left.data(), rowSums.data(), rows, inner);
+				Shakara::Kernels::SumColumns(left.data(), columnSums.data(), rows, inner);
+
+				float expectedRow    = 0.0f;
+				float expectedColumn = 0.0f;
+
+				for (size_t column = 0; column < inner; column++)
+					expectedRow += left[inner + column];
+
+				for (size_t row = 0; row < rows; row++)
+					expectedColumn += left[row * inner + 2];
+
+				Assert::AreEqual(expectedRow, rowSums[1]);
+				Assert::AreEqual(expectedColumn, columnSums[2]);
+			}
+		};
+	}
+}
\ No newline at end of file
@@ -757,6 +757,190 @@ namespace ShakaraTest
 				);
 			}
 
+			TEST_METHOD(TokenizeFor)
+			{
+				std::string statement = R"(
+					for (index in 0..amt(values))
+						print(index)
+				)";
+
+				std::stringstream stream(statement, std::ios::in);
+
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Make sure that the two periods of the range
+				// are a single token, and the zero before them
+				// isn't read as a decimal
+				Assert::AreEqual(static_cast<size_t>(15), tokens.size());
+
+				// Next, make sure that each token is
+				// the right type
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::FOR_STATEMENT),
+					static_cast<uint8_t>(tokens[0].type),
+					L"Incorrect token type! Expected FOR_STATEMENT!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::BEGIN_ARGS),
+					static_cast<uint8_t>(tokens[1].type),
+					L"Incorrect token type! Expected BEGIN_ARGS!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::IDENTIFIER),
+					static_cast<uint8_t>(tokens[2].type),
+					L"Incorrect token type! Expected IDENTIFIER!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::IN),
+					static_cast<uint8_t>(tokens[3].type),
+					L"Incorrect token type! Expected IN!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::INTEGER),
+					static_cast<uint8_t>(tokens[4].type),
+					L"Incorrect token type! Expected INTEGER!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::RANGE),
+					static_cast<uint8_t>(tokens[5].type),
+					L"Incorrect token type! Expected RANGE!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::IDENTIFIER),
+					static_cast<uint8_t>(tokens[6].type),
+					L"Incorrect token type! Expected IDENTIFIER!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::BEGIN_ARGS),
+					static_cast<uint8_t>(tokens[7].type),
+					L"Incorrect token type! Expected BEGIN_ARGS!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::IDENTIFIER),
+					static_cast<uint8_t>(tokens[8].type),
+					L"Incorrect token type! Expected IDENTIFIER!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::END_ARGS),
+					static_cast<uint8_t>(tokens[9].type),
+					L"Incorrect token type! Expected END_ARGS!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::END_ARGS),
+					static_cast<uint8_t>(tokens[10].type),
+					L"Incorrect token type! Expected END_ARGS!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::IDENTIFIER),
+					static_cast<uint8_t>(tokens[11].type),
+					L"Incorrect token type! Expected IDENTIFIER!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::BEGIN_ARGS),
+					static_cast<uint8_t>(tokens[12].type),
+					L"Incorrect token type! Expected BEGIN_ARGS!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::IDENTIFIER),
+					static_cast<uint8_t>(tokens[13].type),
+					L"Incorrect token type! Expected IDENTIFIER!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::END_ARGS),
+					static_cast<uint8_t>(tokens[14].type),
+					L"Incorrect token type! Expected END_ARGS!"
+				);
+			}
+
+			TEST_METHOD(TokenizeBreakContinue)
+			{
+				std::string statement = R"(
+					while (true)
+					{
+						if (done)
+							break
+						continue
+					}
+				)";
+
+				std::stringstream stream(statement, std::ios::in);
+
+				std::vector<Shakara::Token> tokens;
+
+				Shakara::Tokenizer tokenizer;
+				tokenizer.Tokenize(stream, tokens);
+
+				// Make sure that we have a token for
+				// each part of the test statement
+				Assert::AreEqual(static_cast<size_t>(12), tokens.size());
+
+				// Next, make sure that each token is
+				// the right type
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::WHILE_STATEMENT),
+					static_cast<uint8_t>(tokens[0].type),
+					L"Incorrect token type! Expected WHILE_STATEMENT!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::BEGIN_ARGS),
+					static_cast<uint8_t>(tokens[1].type),
+					L"Incorrect token type! Expected BEGIN_ARGS!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::BOOLEAN),
+					static_cast<uint8_t>(tokens[2].type),
+					L"Incorrect token type! Expected BOOLEAN!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::END_ARGS),
+					static_cast<uint8_t>(tokens[3].type),
+					L"Incorrect token type! Expected END_ARGS!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::BEGIN_BLOCK),
+					static_cast<uint8_t>(tokens[4].type),
+					L"Incorrect token type! Expected BEGIN_BLOCK!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::IF_STATEMENT),
+					static_cast<uint8_t>(tokens[5].type),
+					L"Incorrect token type! Expected IF_STATEMENT!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::BEGIN_ARGS),
+					static_cast<uint8_t>(tokens[6].type),
+					L"Incorrect token type! Expected BEGIN_ARGS!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::IDENTIFIER),
+					static_cast<uint8_t>(tokens[7].type),
+					L"Incorrect token type! Expected IDENTIFIER!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::END_ARGS),
+					static_cast<uint8_t>(tokens[8].type),
+					L"Incorrect token type! Expected END_ARGS!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::BREAK_STATEMENT),
+					static_cast<uint8_t>(tokens[9].type),
+					L"Incorrect token type! Expected BREAK_STATEMENT!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::CONTINUE_STATEMENT),
+					static_cast<uint8_t>(tokens[10].type),
+					L"Incorrect token type! Expected CONTINUE_STATEMENT!"
+				);
+				Assert::AreEqual(
+					static_cast<uint8_t>(Shakara::TokenType::END_BLOCK),
+					static_cast<uint8_t>(tokens[11].type),
+					L"Incorrect token type! Expected END_BLOCK!"
+				);
+			}
+
 			TEST_METHOD(TokenizeArrayBrackets)
 			{
 				std::string statement = R"(
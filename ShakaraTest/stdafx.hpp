@@ -10,6 +10,11 @@
 #include <sstream>
 #include <functional>
 #include <map>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <cstring>
+#include <algorithm>
 
 #include "../Shakara/Tokenizer/TokenizerTypes.hpp"
 #include "../Shakara/Tokenizer/Tokenizer.hpp"
@@ -17,6 +22,7 @@
 #include "../Shakara/AST/ASTNode.hpp"
 #include "../Shakara/AST/ASTTypes.hpp"
 #include "../Shakara/AST/ASTBuilder.hpp"
+#include "../Shakara/AST/ASTChecker.hpp"
 #include "../Shakara/AST/Nodes/ASTRootNode.hpp"
 #include "../Shakara/AST/Nodes/ASTAssignmentNode.hpp"
 #include "../Shakara/AST/Nodes/ASTBinaryOperation.hpp"
@@ -26,5 +32,12 @@
 #include "../Shakara/AST/Nodes/ASTDecimalNode.hpp"
 #include "../Shakara/AST/Nodes/ASTArrayNode.hpp"
 #include "../Shakara/AST/Nodes/ASTArrayElementIdentifier.hpp"
+#include "../Shakara/AST/Nodes/ASTMapNode.hpp"
+#include "../Shakara/AST/Nodes/ASTStructDeclarationNode.hpp"
+#include "../Shakara/AST/Nodes/ASTStructNode.hpp"
+#include "../Shakara/AST/Nodes/ASTMemberIdentifier.hpp"
+#include "../Shakara/AST/Nodes/ASTMatrixNode.hpp"
+#include "../Shakara/AST/Nodes/ASTForStatementNode.hpp"
 
-#include "../Shakara/Interpreter/Interpreter.hpp"
\ No newline at end of file
+#include "../Shakara/Interpreter/Interpreter.hpp"
+#include "../Shakara/Interpreter/ArrayKernels.hpp"
\ No newline at end of file